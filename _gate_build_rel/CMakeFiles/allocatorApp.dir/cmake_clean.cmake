@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/allocatorApp.dir/test/targets/AllocatorApp.C.o"
+  "CMakeFiles/allocatorApp.dir/test/targets/AllocatorApp.C.o.d"
+  "allocatorApp"
+  "allocatorApp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/allocatorApp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
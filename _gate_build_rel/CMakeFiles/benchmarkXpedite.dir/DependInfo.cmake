@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/benchmark/Collector.C" "CMakeFiles/benchmarkXpedite.dir/test/benchmark/Collector.C.o" "gcc" "CMakeFiles/benchmarkXpedite.dir/test/benchmark/Collector.C.o.d"
+  "/root/repo/test/benchmark/Probes.C" "CMakeFiles/benchmarkXpedite.dir/test/benchmark/Probes.C.o" "gcc" "CMakeFiles/benchmarkXpedite.dir/test/benchmark/Probes.C.o.d"
+  "/root/repo/test/benchmark/Recorders.C" "CMakeFiles/benchmarkXpedite.dir/test/benchmark/Recorders.C.o" "gcc" "CMakeFiles/benchmarkXpedite.dir/test/benchmark/Recorders.C.o.d"
+  "/root/repo/test/benchmark/WaitFreeBufferPool.C" "CMakeFiles/benchmarkXpedite.dir/test/benchmark/WaitFreeBufferPool.C.o" "gcc" "CMakeFiles/benchmarkXpedite.dir/test/benchmark/WaitFreeBufferPool.C.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_rel/CMakeFiles/xpedite.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmarkXpedite.dir/test/benchmark/Collector.C.o"
+  "CMakeFiles/benchmarkXpedite.dir/test/benchmark/Collector.C.o.d"
+  "CMakeFiles/benchmarkXpedite.dir/test/benchmark/Probes.C.o"
+  "CMakeFiles/benchmarkXpedite.dir/test/benchmark/Probes.C.o.d"
+  "CMakeFiles/benchmarkXpedite.dir/test/benchmark/Recorders.C.o"
+  "CMakeFiles/benchmarkXpedite.dir/test/benchmark/Recorders.C.o.d"
+  "CMakeFiles/benchmarkXpedite.dir/test/benchmark/WaitFreeBufferPool.C.o"
+  "CMakeFiles/benchmarkXpedite.dir/test/benchmark/WaitFreeBufferPool.C.o.d"
+  "benchmarkXpedite"
+  "benchmarkXpedite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmarkXpedite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
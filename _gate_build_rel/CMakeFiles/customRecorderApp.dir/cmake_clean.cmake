@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/customRecorderApp.dir/test/targets/CustomRecorderApp.C.o"
+  "CMakeFiles/customRecorderApp.dir/test/targets/CustomRecorderApp.C.o.d"
+  "customRecorderApp"
+  "customRecorderApp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/customRecorderApp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dataTxnApp.dir/test/targets/DataTxnApp.C.o"
+  "CMakeFiles/dataTxnApp.dir/test/targets/DataTxnApp.C.o.d"
+  "dataTxnApp"
+  "dataTxnApp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dataTxnApp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/driver"
+  "xpedite.ko"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/driver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
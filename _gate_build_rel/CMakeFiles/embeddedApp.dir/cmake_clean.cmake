@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/embeddedApp.dir/test/targets/EmbeddedApp.C.o"
+  "CMakeFiles/embeddedApp.dir/test/targets/EmbeddedApp.C.o.d"
+  "embeddedApp"
+  "embeddedApp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/embeddedApp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/multiThreadedApp.dir/test/targets/MultiThreadedApp.C.o"
+  "CMakeFiles/multiThreadedApp.dir/test/targets/MultiThreadedApp.C.o.d"
+  "multiThreadedApp"
+  "multiThreadedApp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/multiThreadedApp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
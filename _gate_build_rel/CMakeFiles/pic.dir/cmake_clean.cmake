@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pic.dir/test/targets/PicLib.C.o"
+  "CMakeFiles/pic.dir/test/targets/PicLib.C.o.d"
+  "libpic.pdb"
+  "libpic.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/picApp.dir/test/targets/PicApp.C.o"
+  "CMakeFiles/picApp.dir/test/targets/PicApp.C.o.d"
+  "picApp"
+  "picApp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/picApp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
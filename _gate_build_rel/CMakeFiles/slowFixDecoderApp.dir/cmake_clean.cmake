@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/slowFixDecoderApp.dir/test/targets/SlowFixDecoder.C.o"
+  "CMakeFiles/slowFixDecoderApp.dir/test/targets/SlowFixDecoder.C.o.d"
+  "slowFixDecoderApp"
+  "slowFixDecoderApp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slowFixDecoderApp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
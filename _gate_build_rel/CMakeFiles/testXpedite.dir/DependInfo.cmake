@@ -0,0 +1,48 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bin/ColumnarWriter.C" "CMakeFiles/testXpedite.dir/bin/ColumnarWriter.C.o" "gcc" "CMakeFiles/testXpedite.dir/bin/ColumnarWriter.C.o.d"
+  "/root/repo/bin/TxnBuilder.C" "CMakeFiles/testXpedite.dir/bin/TxnBuilder.C.o" "gcc" "CMakeFiles/testXpedite.dir/bin/TxnBuilder.C.o.d"
+  "/root/repo/test/gtest/AllocationCounters.C" "CMakeFiles/testXpedite.dir/test/gtest/AllocationCounters.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/AllocationCounters.C.o.d"
+  "/root/repo/test/gtest/Allocator.C" "CMakeFiles/testXpedite.dir/test/gtest/Allocator.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/Allocator.C.o.d"
+  "/root/repo/test/gtest/AtoiHex.C" "CMakeFiles/testXpedite.dir/test/gtest/AtoiHex.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/AtoiHex.C.o.d"
+  "/root/repo/test/gtest/CollectorPolicy.C" "CMakeFiles/testXpedite.dir/test/gtest/CollectorPolicy.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/CollectorPolicy.C.o.d"
+  "/root/repo/test/gtest/ColumnarWriter.C" "CMakeFiles/testXpedite.dir/test/gtest/ColumnarWriter.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/ColumnarWriter.C.o.d"
+  "/root/repo/test/gtest/FlightRecorder.C" "CMakeFiles/testXpedite.dir/test/gtest/FlightRecorder.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/FlightRecorder.C.o.d"
+  "/root/repo/test/gtest/Framework.C" "CMakeFiles/testXpedite.dir/test/gtest/Framework.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/Framework.C.o.d"
+  "/root/repo/test/gtest/Histogram.C" "CMakeFiles/testXpedite.dir/test/gtest/Histogram.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/Histogram.C.o.d"
+  "/root/repo/test/gtest/Main.C" "CMakeFiles/testXpedite.dir/test/gtest/Main.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/Main.C.o.d"
+  "/root/repo/test/gtest/MemOpReport.C" "CMakeFiles/testXpedite.dir/test/gtest/MemOpReport.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/MemOpReport.C.o.d"
+  "/root/repo/test/gtest/PMUCtl.C" "CMakeFiles/testXpedite.dir/test/gtest/PMUCtl.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/PMUCtl.C.o.d"
+  "/root/repo/test/gtest/Payload.C" "CMakeFiles/testXpedite.dir/test/gtest/Payload.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/Payload.C.o.d"
+  "/root/repo/test/gtest/PerfEventsApi.C" "CMakeFiles/testXpedite.dir/test/gtest/PerfEventsApi.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/PerfEventsApi.C.o.d"
+  "/root/repo/test/gtest/Pmc.C" "CMakeFiles/testXpedite.dir/test/gtest/Pmc.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/Pmc.C.o.d"
+  "/root/repo/test/gtest/Probe.C" "CMakeFiles/testXpedite.dir/test/gtest/Probe.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/Probe.C.o.d"
+  "/root/repo/test/gtest/ProbeData.C" "CMakeFiles/testXpedite.dir/test/gtest/ProbeData.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/ProbeData.C.o.d"
+  "/root/repo/test/gtest/ProbeOverhead.C" "CMakeFiles/testXpedite.dir/test/gtest/ProbeOverhead.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/ProbeOverhead.C.o.d"
+  "/root/repo/test/gtest/RequestParser.C" "CMakeFiles/testXpedite.dir/test/gtest/RequestParser.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/RequestParser.C.o.d"
+  "/root/repo/test/gtest/SamplesBufferPolicy.C" "CMakeFiles/testXpedite.dir/test/gtest/SamplesBufferPolicy.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/SamplesBufferPolicy.C.o.d"
+  "/root/repo/test/gtest/SamplesFile.C" "CMakeFiles/testXpedite.dir/test/gtest/SamplesFile.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/SamplesFile.C.o.d"
+  "/root/repo/test/gtest/Sampling.C" "CMakeFiles/testXpedite.dir/test/gtest/Sampling.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/Sampling.C.o.d"
+  "/root/repo/test/gtest/Telemetry.C" "CMakeFiles/testXpedite.dir/test/gtest/Telemetry.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/Telemetry.C.o.d"
+  "/root/repo/test/gtest/TlScopedData.C" "CMakeFiles/testXpedite.dir/test/gtest/TlScopedData.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/TlScopedData.C.o.d"
+  "/root/repo/test/gtest/Transport.C" "CMakeFiles/testXpedite.dir/test/gtest/Transport.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/Transport.C.o.d"
+  "/root/repo/test/gtest/TscCalibration.C" "CMakeFiles/testXpedite.dir/test/gtest/TscCalibration.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/TscCalibration.C.o.d"
+  "/root/repo/test/gtest/TxnBuilder.C" "CMakeFiles/testXpedite.dir/test/gtest/TxnBuilder.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/TxnBuilder.C.o.d"
+  "/root/repo/test/gtest/WaitFreeBufferPool.C" "CMakeFiles/testXpedite.dir/test/gtest/WaitFreeBufferPool.C.o" "gcc" "CMakeFiles/testXpedite.dir/test/gtest/WaitFreeBufferPool.C.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_rel/CMakeFiles/xpedite.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,67 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testXpedite.dir/bin/ColumnarWriter.C.o"
+  "CMakeFiles/testXpedite.dir/bin/ColumnarWriter.C.o.d"
+  "CMakeFiles/testXpedite.dir/bin/TxnBuilder.C.o"
+  "CMakeFiles/testXpedite.dir/bin/TxnBuilder.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/AllocationCounters.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/AllocationCounters.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/Allocator.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/Allocator.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/AtoiHex.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/AtoiHex.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/CollectorPolicy.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/CollectorPolicy.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/ColumnarWriter.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/ColumnarWriter.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/FlightRecorder.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/FlightRecorder.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/Framework.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/Framework.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/Histogram.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/Histogram.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/Main.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/Main.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/MemOpReport.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/MemOpReport.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/PMUCtl.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/PMUCtl.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/Payload.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/Payload.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/PerfEventsApi.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/PerfEventsApi.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/Pmc.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/Pmc.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/Probe.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/Probe.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/ProbeData.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/ProbeData.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/ProbeOverhead.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/ProbeOverhead.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/RequestParser.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/RequestParser.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/SamplesBufferPolicy.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/SamplesBufferPolicy.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/SamplesFile.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/SamplesFile.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/Sampling.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/Sampling.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/Telemetry.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/Telemetry.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/TlScopedData.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/TlScopedData.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/Transport.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/Transport.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/TscCalibration.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/TscCalibration.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/TxnBuilder.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/TxnBuilder.C.o.d"
+  "CMakeFiles/testXpedite.dir/test/gtest/WaitFreeBufferPool.C.o"
+  "CMakeFiles/testXpedite.dir/test/gtest/WaitFreeBufferPool.C.o.d"
+  "testXpedite"
+  "testXpedite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testXpedite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,87 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "ASM"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_ASM
+  "/root/repo/lib/xpedite/probes/DataProbeCtl.S" "/root/repo/_gate_build_rel/CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/DataProbeCtl.S.o"
+  "/root/repo/lib/xpedite/probes/IdentityProbeCtl.S" "/root/repo/_gate_build_rel/CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/IdentityProbeCtl.S.o"
+  "/root/repo/lib/xpedite/probes/PayloadProbeCtl.S" "/root/repo/_gate_build_rel/CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/PayloadProbeCtl.S.o"
+  "/root/repo/lib/xpedite/probes/ProbeCtl.S" "/root/repo/_gate_build_rel/CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/ProbeCtl.S.o"
+  )
+set(CMAKE_ASM_COMPILER_ID "GNU")
+
+# Preprocessor definitions for this target.
+set(CMAKE_TARGET_DEFINITIONS_ASM
+  "XPEDITE_PIE=1"
+  "xpedite_pic_EXPORTS"
+  )
+
+# The include file search paths:
+set(CMAKE_ASM_TARGET_INCLUDE_PATH
+  "/root/repo/include"
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/xpedite/pmu/EventSet.c" "CMakeFiles/xpedite-pic.dir/lib/xpedite/pmu/EventSet.c.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/pmu/EventSet.c.o.d"
+  "/root/repo/lib/xpedite/pmu/Formatter.c" "CMakeFiles/xpedite-pic.dir/lib/xpedite/pmu/Formatter.c.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/pmu/Formatter.c.o.d"
+  "/root/repo/lib/xpedite/framework/Aggregator.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/Aggregator.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/Aggregator.C.o.d"
+  "/root/repo/lib/xpedite/framework/Collector.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/Collector.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/Collector.C.o.d"
+  "/root/repo/lib/xpedite/framework/CollectorWorker.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/CollectorWorker.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/CollectorWorker.C.o.d"
+  "/root/repo/lib/xpedite/framework/FlightRecorder.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/FlightRecorder.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/FlightRecorder.C.o.d"
+  "/root/repo/lib/xpedite/framework/Framework.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/Framework.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/Framework.C.o.d"
+  "/root/repo/lib/xpedite/framework/Handler.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/Handler.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/Handler.C.o.d"
+  "/root/repo/lib/xpedite/framework/Persister.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/Persister.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/Persister.C.o.d"
+  "/root/repo/lib/xpedite/framework/ProbeOverhead.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/ProbeOverhead.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/ProbeOverhead.C.o.d"
+  "/root/repo/lib/xpedite/framework/SampleCodec.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/SampleCodec.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/SampleCodec.C.o.d"
+  "/root/repo/lib/xpedite/framework/SamplesBuffer.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/SamplesBuffer.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/SamplesBuffer.C.o.d"
+  "/root/repo/lib/xpedite/framework/SamplesBufferPolicy.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/SamplesBufferPolicy.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/SamplesBufferPolicy.C.o.d"
+  "/root/repo/lib/xpedite/framework/SamplesFile.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/SamplesFile.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/SamplesFile.C.o.d"
+  "/root/repo/lib/xpedite/framework/SamplesStream.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/SamplesStream.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/SamplesStream.C.o.d"
+  "/root/repo/lib/xpedite/framework/StorageMgr.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/StorageMgr.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/StorageMgr.C.o.d"
+  "/root/repo/lib/xpedite/framework/Telemetry.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/Telemetry.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/Telemetry.C.o.d"
+  "/root/repo/lib/xpedite/framework/request/Request.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/request/Request.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/request/Request.C.o.d"
+  "/root/repo/lib/xpedite/framework/request/RequestParser.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/request/RequestParser.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/request/RequestParser.C.o.d"
+  "/root/repo/lib/xpedite/framework/session/RemoteSession.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/session/RemoteSession.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/framework/session/RemoteSession.C.o.d"
+  "/root/repo/lib/xpedite/intercept/AllocationCounters.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/intercept/AllocationCounters.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/intercept/AllocationCounters.C.o.d"
+  "/root/repo/lib/xpedite/intercept/Intercept.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/intercept/Intercept.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/intercept/Intercept.C.o.d"
+  "/root/repo/lib/xpedite/intercept/InterceptFallback.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/intercept/InterceptFallback.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/intercept/InterceptFallback.C.o.d"
+  "/root/repo/lib/xpedite/intercept/Report.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/intercept/Report.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/intercept/Report.C.o.d"
+  "/root/repo/lib/xpedite/log/Log.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/log/Log.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/log/Log.C.o.d"
+  "/root/repo/lib/xpedite/perf/PerfEvent.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/perf/PerfEvent.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/perf/PerfEvent.C.o.d"
+  "/root/repo/lib/xpedite/perf/PerfEventAttrSet.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/perf/PerfEventAttrSet.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/perf/PerfEventAttrSet.C.o.d"
+  "/root/repo/lib/xpedite/perf/PerfEventReadPlan.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/perf/PerfEventReadPlan.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/perf/PerfEventReadPlan.C.o.d"
+  "/root/repo/lib/xpedite/perf/PerfEventSet.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/perf/PerfEventSet.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/perf/PerfEventSet.C.o.d"
+  "/root/repo/lib/xpedite/perf/PerfEventsApi.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/perf/PerfEventsApi.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/perf/PerfEventsApi.C.o.d"
+  "/root/repo/lib/xpedite/perf/PerfEventsCtl.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/perf/PerfEventsCtl.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/perf/PerfEventsCtl.C.o.d"
+  "/root/repo/lib/xpedite/pmu/PMUCtl.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/pmu/PMUCtl.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/pmu/PMUCtl.C.o.d"
+  "/root/repo/lib/xpedite/probes/Config.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/Config.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/Config.C.o.d"
+  "/root/repo/lib/xpedite/probes/Probe.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/Probe.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/Probe.C.o.d"
+  "/root/repo/lib/xpedite/probes/ProbeCtl.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/ProbeCtl.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/ProbeCtl.C.o.d"
+  "/root/repo/lib/xpedite/probes/ProbeList.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/ProbeList.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/ProbeList.C.o.d"
+  "/root/repo/lib/xpedite/probes/RecorderCtl.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/RecorderCtl.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/RecorderCtl.C.o.d"
+  "/root/repo/lib/xpedite/probes/Recorders.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/Recorders.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/Recorders.C.o.d"
+  "/root/repo/lib/xpedite/probes/SamplingPolicy.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/SamplingPolicy.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/probes/SamplingPolicy.C.o.d"
+  "/root/repo/lib/xpedite/transport/Framer.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/transport/Framer.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/transport/Framer.C.o.d"
+  "/root/repo/lib/xpedite/transport/Listener.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/transport/Listener.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/transport/Listener.C.o.d"
+  "/root/repo/lib/xpedite/transport/Notifier.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/transport/Notifier.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/transport/Notifier.C.o.d"
+  "/root/repo/lib/xpedite/transport/Poller.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/transport/Poller.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/transport/Poller.C.o.d"
+  "/root/repo/lib/xpedite/util/AddressSpace.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/util/AddressSpace.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/util/AddressSpace.C.o.d"
+  "/root/repo/lib/xpedite/util/Allocator.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/util/Allocator.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/util/Allocator.C.o.d"
+  "/root/repo/lib/xpedite/util/HdrHistogram.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/util/HdrHistogram.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/util/HdrHistogram.C.o.d"
+  "/root/repo/lib/xpedite/util/ThreadInfo.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/util/ThreadInfo.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/util/ThreadInfo.C.o.d"
+  "/root/repo/lib/xpedite/util/TscCalibration.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/util/TscCalibration.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/util/TscCalibration.C.o.d"
+  "/root/repo/lib/xpedite/util/Util.C" "CMakeFiles/xpedite-pic.dir/lib/xpedite/util/Util.C.o" "gcc" "CMakeFiles/xpedite-pic.dir/lib/xpedite/util/Util.C.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
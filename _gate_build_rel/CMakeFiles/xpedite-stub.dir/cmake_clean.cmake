@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xpedite-stub.dir/lib/stub/Stub.C.o"
+  "CMakeFiles/xpedite-stub.dir/lib/stub/Stub.C.o.d"
+  "libxpedite-stub.pdb"
+  "libxpedite-stub.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xpedite-stub.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,111 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/Aggregator.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/Aggregator.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/Collector.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/Collector.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/CollectorWorker.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/CollectorWorker.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/FlightRecorder.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/FlightRecorder.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/Framework.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/Framework.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/Handler.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/Handler.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/Persister.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/Persister.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/ProbeOverhead.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/ProbeOverhead.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/SampleCodec.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/SampleCodec.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/SamplesBuffer.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/SamplesBuffer.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/SamplesBufferPolicy.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/SamplesBufferPolicy.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/SamplesFile.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/SamplesFile.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/SamplesStream.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/SamplesStream.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/StorageMgr.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/StorageMgr.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/Telemetry.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/Telemetry.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/request/Request.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/request/Request.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/request/RequestParser.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/request/RequestParser.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/session/RemoteSession.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/framework/session/RemoteSession.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/intercept/AllocationCounters.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/intercept/AllocationCounters.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/intercept/Intercept.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/intercept/Intercept.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/intercept/InterceptFallback.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/intercept/InterceptFallback.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/intercept/Report.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/intercept/Report.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/log/Log.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/log/Log.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/perf/PerfEvent.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/perf/PerfEvent.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/perf/PerfEventAttrSet.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/perf/PerfEventAttrSet.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/perf/PerfEventReadPlan.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/perf/PerfEventReadPlan.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/perf/PerfEventSet.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/perf/PerfEventSet.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/perf/PerfEventsApi.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/perf/PerfEventsApi.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/perf/PerfEventsCtl.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/perf/PerfEventsCtl.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/pmu/EventSet.c.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/pmu/EventSet.c.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/pmu/Formatter.c.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/pmu/Formatter.c.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/pmu/PMUCtl.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/pmu/PMUCtl.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/Config.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/Config.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/DataProbeCtl.S.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/IdentityProbeCtl.S.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/PayloadProbeCtl.S.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/Probe.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/Probe.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/ProbeCtl.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/ProbeCtl.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/ProbeCtl.S.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/ProbeList.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/ProbeList.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/RecorderCtl.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/RecorderCtl.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/Recorders.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/Recorders.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/SamplingPolicy.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/probes/SamplingPolicy.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/transport/Framer.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/transport/Framer.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/transport/Listener.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/transport/Listener.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/transport/Notifier.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/transport/Notifier.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/transport/Poller.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/transport/Poller.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/util/AddressSpace.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/util/AddressSpace.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/util/Allocator.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/util/Allocator.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/util/HdrHistogram.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/util/HdrHistogram.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/util/ThreadInfo.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/util/ThreadInfo.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/util/TscCalibration.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/util/TscCalibration.C.o.d"
+  "CMakeFiles/xpedite.dir/lib/xpedite/util/Util.C.o"
+  "CMakeFiles/xpedite.dir/lib/xpedite/util/Util.C.o.d"
+  "libxpedite.a"
+  "libxpedite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang ASM C CXX)
+  include(CMakeFiles/xpedite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
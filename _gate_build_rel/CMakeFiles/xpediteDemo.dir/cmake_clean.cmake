@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xpediteDemo.dir/demo/Demo.C.o"
+  "CMakeFiles/xpediteDemo.dir/demo/Demo.C.o.d"
+  "xpediteDemo"
+  "xpediteDemo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xpediteDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
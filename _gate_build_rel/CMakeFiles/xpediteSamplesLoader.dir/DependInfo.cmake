@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bin/ColumnarWriter.C" "CMakeFiles/xpediteSamplesLoader.dir/bin/ColumnarWriter.C.o" "gcc" "CMakeFiles/xpediteSamplesLoader.dir/bin/ColumnarWriter.C.o.d"
+  "/root/repo/bin/SamplesLoader.C" "CMakeFiles/xpediteSamplesLoader.dir/bin/SamplesLoader.C.o" "gcc" "CMakeFiles/xpediteSamplesLoader.dir/bin/SamplesLoader.C.o.d"
+  "/root/repo/bin/TxnBuilder.C" "CMakeFiles/xpediteSamplesLoader.dir/bin/TxnBuilder.C.o" "gcc" "CMakeFiles/xpediteSamplesLoader.dir/bin/TxnBuilder.C.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_rel/CMakeFiles/xpedite.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xpediteSamplesLoader.dir/bin/ColumnarWriter.C.o"
+  "CMakeFiles/xpediteSamplesLoader.dir/bin/ColumnarWriter.C.o.d"
+  "CMakeFiles/xpediteSamplesLoader.dir/bin/SamplesLoader.C.o"
+  "CMakeFiles/xpediteSamplesLoader.dir/bin/SamplesLoader.C.o.d"
+  "CMakeFiles/xpediteSamplesLoader.dir/bin/TxnBuilder.C.o"
+  "CMakeFiles/xpediteSamplesLoader.dir/bin/TxnBuilder.C.o.d"
+  "xpediteSamplesLoader"
+  "xpediteSamplesLoader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xpediteSamplesLoader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_gate_build_rel
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testXpedite "/root/repo/_gate_build_rel/testXpedite")
+set_tests_properties(testXpedite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;152;add_test;/root/repo/CMakeLists.txt;0;")
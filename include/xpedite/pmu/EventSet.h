@@ -8,6 +8,10 @@
 //
 // PMUCtlRequest - Collection of pmc events to be programmed
 //
+// PMUCtlBatchRequest - Collection of pmc events to be programmed in a set of cpus, in one call
+//
+// PMUCtlBatchStatus - Status of each cpu, for the last batch request (read back from the device)
+//
 // EventSelect - A machine friendly representation of programmable pmc events
 //
 // Author: Manikandan Dhamodharan, Morgan Stanley
@@ -26,6 +30,10 @@
 
 #define XPEDITE_PMC_CTRL_OFFCORE_EVENT_MAX 2
 
+#define XPEDITE_PMC_CTRL_CPU_MAX 256
+
+#define XPEDITE_PMC_CTRL_CPU_SKIPPED 1
+
 typedef struct __attribute__ ((__packed__))
 {
   unsigned char _ctrIndex;
@@ -49,7 +57,7 @@ typedef uint64_t PMUOffcoreEvent;
  
 typedef struct __attribute__ ((__packed__))
 {
-  unsigned char _cpu;
+  unsigned short _cpu; /* wide enough for cpus beyond the capacity of batch requests */
   unsigned char _fixedEvtCount;
   unsigned char _gpEvtCount;
   unsigned char _offcoreEvtCount;
@@ -58,6 +66,18 @@ typedef struct __attribute__ ((__packed__))
   PMUOffcoreEvent _offcoreEvents[XPEDITE_PMC_CTRL_OFFCORE_EVENT_MAX];
 } PMUCtlRequest;
 
+typedef struct __attribute__ ((__packed__))
+{
+  uint64_t _cpuMask[XPEDITE_PMC_CTRL_CPU_MAX / 64];
+  PMUCtlRequest _request; /* _cpu is ignored */
+} PMUCtlBatchRequest;
+
+typedef struct __attribute__ ((__packed__))
+{
+  /* 0 if programmed, XPEDITE_PMC_CTRL_CPU_SKIPPED for cpus not in the mask, or a negative error code */
+  int32_t _status[XPEDITE_PMC_CTRL_CPU_MAX];
+} PMUCtlBatchStatus;
+
 typedef struct
 {
   unsigned char _fixedEvtGlobalCtl;
@@ -45,4 +45,7 @@ typedef enum
 
 extern ssize_t pmuEnableEventSet(EventSet* eventSet);
 
+// reprograms counters, clearing general purpose counters of the active event set, in excess of the new one
+extern ssize_t pmuSwitchEventSet(EventSet* eventSet, unsigned char activeGpEvtCount_);
+
 extern ssize_t pmuClearEventSet(unsigned char gpEvtCount_);
@@ -0,0 +1,66 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Test for recording of probes, through the Xpedite JNI library
+//
+// Threads record probes, enough to expand their samples buffers, while the
+// main thread requests garbage collections. Recording must not hold off the
+// safepoints of collections and collections must not stall recording.
+//
+// Author: Brooke Elizabeth Cantwell, Morgan Stanley
+//
+///////////////////////////////////////////////////////////////////////////////
+
+package com.xpedite;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+import org.junit.Test;
+
+public class XpediteTest {
+    private static final int THREAD_COUNT = 4;
+    private static final int RECORD_COUNT = 1 << 20;
+
+    private static long collectionCount() {
+        long count = 0;
+        for (GarbageCollectorMXBean collector : ManagementFactory.getGarbageCollectorMXBeans()) {
+            count += Math.max(collector.getCollectionCount(), 0);
+        }
+        return count;
+    }
+
+    @Test(timeout = 60000)
+    public void recordDuringCollections() throws InterruptedException {
+        Xpedite.getInstance();
+        AtomicInteger completedCount = new AtomicInteger();
+        List<Thread> threads = new ArrayList<>();
+        for (int i = 0; i < THREAD_COUNT; ++i) {
+            final int id = i + 1;
+            Thread thread = new Thread(() -> {
+                for (int j = 0; j < RECORD_COUNT; ++j) {
+                    Xpedite.record(id);
+                }
+                completedCount.incrementAndGet();
+            });
+            threads.add(thread);
+            thread.start();
+        }
+
+        long collections = collectionCount();
+        while (completedCount.get() < THREAD_COUNT) {
+            System.gc();
+            TimeUnit.MILLISECONDS.sleep(1);
+        }
+        for (Thread thread : threads) {
+            thread.join();
+        }
+        assertEquals("detected threads failing to record probes", THREAD_COUNT, completedCount.get());
+        assertTrue("failed to collect garbage, while threads were recording", collectionCount() > collections);
+    }
+}
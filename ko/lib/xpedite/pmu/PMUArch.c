@@ -130,14 +130,20 @@ ssize_t pmuClearEventSet(unsigned char gpEvtCount_) {
 }
 
 ssize_t pmuEnableEventSet(EventSet *eventSet_) {
+  return pmuSwitchEventSet(eventSet_, eventSet_->_gpEvtCount);
+}
+
+ssize_t pmuSwitchEventSet(EventSet *eventSet_, unsigned char activeGpEvtCount_) {
   u32 low, high;
+  unsigned char clearCount;
 
-  if(eventSet_->_gpEvtCount > XPEDITE_PMC_CTRL_GP_EVENT_MAX) {
+  if(eventSet_->_gpEvtCount > XPEDITE_PMC_CTRL_GP_EVENT_MAX || activeGpEvtCount_ > XPEDITE_PMC_CTRL_GP_EVENT_MAX) {
     eventSet_->_err = -EFAULT;
     return eventSet_->_err;
   }
 
-  eventSet_->_err = pmuClearEventSet(eventSet_->_gpEvtCount);
+  clearCount = activeGpEvtCount_ > eventSet_->_gpEvtCount ? activeGpEvtCount_ : eventSet_->_gpEvtCount;
+  eventSet_->_err = pmuClearEventSet(clearCount);
   if(eventSet_->_err) {
     return eventSet_->_err;
   }
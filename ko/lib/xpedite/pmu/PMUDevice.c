@@ -7,6 +7,12 @@
 // 
 // The module also set flag in CR4 register to permit rdpmc calls from userspace
 //
+// Batch requests program an event set in every cpu of a cpu mask, with a single round of
+// inter processor interrupts, that runs concurrently in all target cpus. Each cpu reprograms
+// its counters with interrupts disabled, hence a batch can switch event sets mid profile,
+// clearing counters of the previous set, without pausing the workload beyond the interrupt.
+// Status of each cpu for the last batch, can be read back from the device.
+//
 // Author: Manikandan Dhamodharan, Morgan Stanley
 //
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -20,6 +26,7 @@
 #include <linux/fs.h>
 #include <linux/mutex.h>
 #include <linux/cpumask.h>
+#include <linux/smp.h>
 #include <xpedite/pmu/EventSet.h>
 #include <xpedite/pmu/PMUArch.h>
 #include <xpedite/pmu/PCECtl.h>
@@ -42,6 +49,18 @@ static DEFINE_MUTEX(pmu_mutex);
 cpumask_t activeCpuSet;
 unsigned char gpEvtCount;
 
+typedef struct
+{
+  EventSet _eventSet;
+  unsigned char _activeGpEvtCount;
+  PMUCtlBatchStatus* _status;
+} EventSetBatch;
+
+// state of batch requests - access is serialized by the device mutex
+static cpumask_t batchCpuSet;
+static PMUCtlBatchStatus batchStatus;
+static int hasBatchStatus;
+
 static int     pmu_open(struct inode *, struct file *);
 static int     pmu_release(struct inode *, struct file *);
 static ssize_t pmu_read(struct file *, char *, size_t, loff_t *);
@@ -106,13 +125,22 @@ static int pmu_open(struct inode *inodep, struct file *filep) {
   ++numberOpens;
   printk(KERN_INFO "Xpedite: device has been opened %d time(s)\n", numberOpens);
   gpEvtCount = 0;
+  hasBatchStatus = 0;
   cpumask_clear(&activeCpuSet);
   return 0;
 }
 
 static ssize_t pmu_read(struct file *filep, char *buffer, size_t len, loff_t *offset) {
-  printk(KERN_INFO "Xpedite: read %zd bytes from userspace\n", len);
-  return -EFAULT;
+  if(!hasBatchStatus || len < sizeof(batchStatus)) {
+    printk(KERN_INFO "Xpedite: invalid read of %zd bytes from userspace | status of batch requests - %zd bytes\n",
+      len, sizeof(batchStatus));
+    return -EFAULT;
+  }
+  if(copy_to_user(buffer, &batchStatus, sizeof(batchStatus))) {
+    printk(KERN_INFO "Xpedite: failed to copy batch status to user space");
+    return -EFAULT;
+  }
+  return sizeof(batchStatus);
 }
 
 static void __pmuEnableEventSet(void *info) {
@@ -125,6 +153,18 @@ static void __pmuEnableEventSet(void *info) {
   }
 }
 
+static void __pmuSwitchEventSet(void *info) {
+  EventSetBatch *batch = (EventSetBatch*) info;
+  // each cpu programs a private copy, as the error code of the event set is updated in place
+  EventSet eventSet = batch->_eventSet;
+  int cpu = smp_processor_id();
+  enablePCE();
+  batch->_status->_status[cpu] = (int32_t) pmuSwitchEventSet(&eventSet, batch->_activeGpEvtCount);
+  if(batch->_status->_status[cpu]) {
+    printk(KERN_ALERT "Xpedite: Failed to enable PMU counters on core %d", cpu);
+  }
+}
+
 static void __pmuClearEventSet(void *info) {
   clearPCE();
   pmuClearEventSet(gpEvtCount);
@@ -163,9 +203,68 @@ static ssize_t processRequest(PMUCtlRequest* request_) {
   return sizeof(PMUCtlRequest);
 }
 
+static ssize_t processBatchRequest(PMUCtlBatchRequest* request_) {
+  EventSetBatch batch;
+  cpumask_t *cpuSet = &batchCpuSet;
+  ssize_t rc = sizeof(PMUCtlBatchRequest);
+  unsigned cpu;
+
+  memset(&batch, 0, sizeof(batch));
+  cpumask_clear(cpuSet);
+  for(cpu = 0; cpu < XPEDITE_PMC_CTRL_CPU_MAX; ++cpu) {
+    batchStatus._status[cpu] = XPEDITE_PMC_CTRL_CPU_SKIPPED;
+    if(request_->_cpuMask[cpu / 64] & (1ULL << (cpu % 64))) {
+      if (cpu >= nr_cpu_ids || !cpu_online(cpu)) {
+        printk(KERN_INFO "Xpedite: invalid batch request - cpu %u not active\n", cpu);
+        batchStatus._status[cpu] = -ENXIO;
+        rc = -ENXIO;
+        continue;
+      }
+      cpumask_set_cpu(cpu, cpuSet);
+    }
+  }
+  hasBatchStatus = 1;
+
+  if(cpumask_empty(cpuSet)) {
+    return rc == sizeof(PMUCtlBatchRequest) ? -EINVAL : rc;
+  }
+
+  if(buildEventSet(&request_->_request, &batch._eventSet)) {
+    return -EFAULT;
+  }
+  logEventSet(&request_->_request, &batch._eventSet);
+
+  batch._activeGpEvtCount = gpEvtCount;
+  batch._status = &batchStatus;
+
+  // a single round of interrupts, programs all cpus concurrently (including the current cpu)
+  on_each_cpu_mask(cpuSet, __pmuSwitchEventSet, &batch, 1);
+
+  for_each_cpu(cpu, cpuSet) {
+    if(batchStatus._status[cpu]) {
+      rc = -EFAULT;
+    }
+    else {
+      cpumask_set_cpu(cpu, &activeCpuSet);
+    }
+  }
+  gpEvtCount = request_->_request._gpEvtCount > gpEvtCount ? request_->_request._gpEvtCount : gpEvtCount;
+  return rc;
+}
+
 static ssize_t pmu_write(struct file *filep, const char *buffer, size_t len, loff_t *offset) {
 
   PMUCtlRequest request;
+  if(len == sizeof(PMUCtlBatchRequest)) {
+    PMUCtlBatchRequest batchRequest;
+    printk(KERN_INFO "Xpedite: processing PMU Ctl batch request (%zd bytes)\n", len);
+    if (copy_from_user(&batchRequest, buffer, sizeof(batchRequest))) {
+      printk(KERN_INFO "Xpedite: failed to copy batch request from user space");
+      return -EFAULT;
+    }
+    return processBatchRequest(&batchRequest);
+  }
+
   if(len != sizeof(PMUCtlRequest)) {
     printk(KERN_INFO "Xpedite: invalid request (expected %zd bytes) | recieved %zd bytes\n", sizeof(PMUCtlRequest), len);
     return -EFAULT;
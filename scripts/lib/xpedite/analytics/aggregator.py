@@ -136,11 +136,17 @@ class TxnAggregator(object):
     :param classifier: Predicate to classify transactions into different categories
     :param cpuInfo: Cpu info to convert cycles to duration (micro seconds)
 
+    Elapsed time is compensated for the calibrated overhead of probes, if any
+
     """
+    probeOverhead = getattr(txnSubCollection, 'probeOverhead', None)
     elapsedTscGroup = {}
     for txn in txnSubCollection:
       if txn:
-        time = cpuInfo.convertCyclesToTime(txn.getElapsedTsc())
+        elapsedTsc = txn.getElapsedTsc()
+        if probeOverhead:
+          elapsedTsc = max(elapsedTsc - (len(txn) - 1) * probeOverhead.cycles, 0)
+        time = cpuInfo.convertCyclesToTime(elapsedTsc)
         TxnAggregator._addOrUpdateContainer(elapsedTscGroup, lambda v: [v], classifier, txn, time)
     return elapsedTscGroup
 
@@ -4,6 +4,10 @@ Module to build timelines, delta series from aggregated transactions
 This module provides the foundation types needed for real time analytics.
 It also includes logic to compute timeline statistics from aggreagated transactions
 
+Intervals between probes are compensated for the overhead of probes, if calibrated for the profile.
+Each interval is inflated by the cost of one probe, hence the calibrated cycles (and pmc values)
+are subtracted from every interval and once per interval, from the total for the transaction.
+
 Author: Manikandan Dhamodharan, Morgan Stanley
 """
 
@@ -430,10 +434,34 @@ class CounterMap(object):
 
 NAN = float('nan')
 
+# Events of a profile are named for the first group of multiplexed pmu events. Counters of other
+# groups, count events not described by the profile - their deltas are excluded from timelines
+NAMED_PMC_GROUP = 0
+
+def compensate(delta, overhead):
+  """
+  Subtracts overhead of probes from a delta of tsc or pmc values
+
+  Compensated deltas are clamped at zero, to absorb jitter of the calibration
+
+  :param delta: Delta between a pair of counters
+  :param overhead: Overhead of probes to be subtracted, zero if not calibrated
+
+  """
+  return max(delta - overhead, 0) if overhead else delta
+
 def buildTimelineStats(category, route, probes, txnSubCollection): # pylint: disable=too-many-locals
   """
   Builds timeline statistics from a subcollection of transactions
 
+  Pmc deltas are undefined (NaN), for pairs of counters from different threads or from different
+  multiplexed groups, and for counters of groups other than the named group.
+  Pmc totals of an endpoint sum the defined deltas, scaled by the share of the transaction's
+  elapsed time, during which the named group was active in the thread.
+
+  Transactions built natively, with routes not needing conflation, take tsc deltas of probes
+  and, unless pmc overhead is compensated, pmc totals of the endpoint from the samples loader
+
   :param probes: List of probes enabled for a profiling session
   :param txnSubCollection: A subcollection of transactions
 
@@ -454,6 +482,8 @@ def buildTimelineStats(category, route, probes, txnSubCollection): # pylint: dis
   tscDeltaSeriesCollection = deltaSeriesRepo.getTscDeltaSeriesCollection()
 
   pmcCount = len(txnSubCollection.events) if txnSubCollection.events else 0
+  probeOverhead = getattr(txnSubCollection, 'probeOverhead', None)
+  overheadCycles = probeOverhead.cycles if probeOverhead else 0
   inceptionTsc = None
   defaultIndices = range(len(route))
 
@@ -461,8 +491,14 @@ def buildTimelineStats(category, route, probes, txnSubCollection): # pylint: dis
   for txnCount, txn in enumerate(txnSubCollection):
     timeline = Timeline(txn)
     indices = conflateRoutes(txn.route, route) if len(txn) > len(route) else defaultIndices
+    probeDeltas = txn.probeDeltas if indices is defaultIndices else None
+    nativePmcDeltas = (txn.pmcDeltas if probeDeltas and txn.pmcDeltas is not None and len(txn.pmcDeltas) == pmcCount
+      and txn[0].pmcGroup == NAMED_PMC_GROUP and not (probeOverhead and probeOverhead.pmcs) else None)
     firstCounter = prevCounter = None
     maxTsc = 0
+    pointTsc = 0
+    intervalCount = 0
+    threadTsc = activeTsc = 0
     i = -1
     endpoint = TimePoint('end', 0, deltaPmcs=([0]* pmcCount if pmcCount > 0 else None))
     for j in indices:
@@ -482,11 +518,17 @@ def buildTimelineStats(category, route, probes, txnSubCollection): # pylint: dis
         if not firstCounter:
           firstCounter = prevCounter = counter
         elif tsc:
-          duration = cpuInfo.convertCyclesToTime(tsc - prevCounter.tsc)
-          point = cpuInfo.convertCyclesToTime(prevCounter.tsc - firstCounter.tsc)
+          elapsedTsc = compensate(probeDeltas[j] if probeDeltas else tsc - prevCounter.tsc, overheadCycles)
+          duration = cpuInfo.convertCyclesToTime(elapsedTsc)
+          point = cpuInfo.convertCyclesToTime(pointTsc)
+          pointTsc += elapsedTsc
+          intervalCount += 1
           timePoint = TimePoint(probes[i-1].name, point, duration, data=prevCounter.data)
 
-          if len(counter.pmcs) < pmcCount:
+          isSameThread = counter.threadId == prevCounter.threadId
+          # counters of different multiplexed groups, count different events - such deltas are undefined
+          isActive = isSameThread and counter.pmcGroup == prevCounter.pmcGroup == NAMED_PMC_GROUP
+          if isActive and len(counter.pmcs) < pmcCount:
             raise InvariantViloation(
               'category [{}] has transaction {} with counter {} '
               'missing pmc samples {}/{}'.format(
@@ -496,9 +538,14 @@ def buildTimelineStats(category, route, probes, txnSubCollection): # pylint: dis
           if pmcCount != 0:
             timePoint.pmcNames = pmcNames
             timePoint.deltaPmcs = []
+            overheadPmcs = (probeOverhead.compensatePmcs(counter.pmcGroup, pmcCount) if probeOverhead
+              else [0] * pmcCount)
+            threadTsc += elapsedTsc if isSameThread else 0
+            activeTsc += elapsedTsc if isActive else 0
             for k in range(pmcCount):
-              deltaPmc = counter.pmcs[k] - prevCounter.pmcs[k] if counter.threadId == prevCounter.threadId  else NAN
-              endpoint.deltaPmcs[k] += (deltaPmc if counter.threadId == prevCounter.threadId else 0)
+              deltaPmc = (compensate(counter.pmcs[k] - prevCounter.pmcs[k], overheadPmcs[k])
+                if isActive else NAN)
+              endpoint.deltaPmcs[k] += (deltaPmc if isActive else 0)
               timePoint.deltaPmcs.append(deltaPmc)
               deltaSeriesRepo[pmcNames[k]][i-1].addDelta(deltaPmc)
             if topdownMetrics:
@@ -523,12 +570,19 @@ def buildTimelineStats(category, route, probes, txnSubCollection): # pylint: dis
         )
 
     if prevCounter:
-      point = cpuInfo.convertCyclesToTime(prevCounter.tsc - firstCounter.tsc)
+      point = cpuInfo.convertCyclesToTime(pointTsc)
       timeline.addTimePoint(TimePoint(probes[-1].name, point, 0, data=prevCounter.data))
 
-    endpoint.duration = cpuInfo.convertCyclesToTime(maxTsc - firstCounter.tsc)
+    endpoint.duration = cpuInfo.convertCyclesToTime(
+      compensate(maxTsc - firstCounter.tsc, intervalCount * overheadCycles)
+    )
     if pmcCount != 0:
       endpoint.pmcNames = pmcNames
+      if nativePmcDeltas is not None:
+        endpoint.deltaPmcs = list(nativePmcDeltas)
+      elif activeTsc != threadTsc:
+        scale = float(threadTsc) / activeTsc if activeTsc else NAN
+        endpoint.deltaPmcs = [deltaPmc * scale for deltaPmc in endpoint.deltaPmcs]
       for k, deltaPmc in enumerate(endpoint.deltaPmcs):
         deltaSeriesRepo[pmcNames[k]][-1].addDelta(deltaPmc)
       if topdownMetrics:
@@ -6,6 +6,10 @@ This module provides logic to
   1. Detect and interact with Xpedite device driver
   2. Build and serialize requests from a list of pmc events
 
+Events are programmed in all cpus of a cpu set, with a single batch request.
+Batches can be resent to switch event sets mid profile, without reopening the device.
+Cpus beyond the capacity of batch requests (CPU_MAX) are programmed with a request per cpu.
+
 Author: Manikandan Dhamodharan, Morgan Stanley
 """
 
@@ -22,6 +26,8 @@ from xpedite.pmu.event       import EventSet
 LOGGER = logging.getLogger(__name__)
 
 XPEDITE_DEVICE = '/dev/xpedite'
+CPU_MAX = 256
+CPU_SKIPPED = 1
 
 def isDriverLoaded():
   """Checks status of Xpedite device driver"""
@@ -40,7 +46,7 @@ class PMUCtrl(object):
       hostname = socket.gethostname()
       raise Exception('Xpedite device driver not loaded | run "xpedite pmc --enable" at '
           'host {} to enable pmc'.format(hostname))
-    self.device = open(XPEDITE_DEVICE, 'w')
+    self.device = open(XPEDITE_DEVICE, 'r+b', 0)
     return self
 
   def __exit__(self, *args):
@@ -57,7 +63,7 @@ class PMUCtrl(object):
 
     """
     request = struct.pack(
-      '=BBBB', cpu, len(eventSet.fixedRequests), len(eventSet.genericRequests), len(eventSet.offcoreRequests)
+      '=HBBB', cpu, len(eventSet.fixedRequests), len(eventSet.genericRequests), len(eventSet.offcoreRequests)
     )
     for event in eventSet.fixedRequests:
       request += event.buildMask()
@@ -75,6 +81,46 @@ class PMUCtrl(object):
       request += OffcorePmuRequest.defaultMask()
     return request
 
+  @staticmethod
+  def buildBatchRequest(cpuSet, eventSet):
+    """
+    Builds a request to program a group of fixed, generic and offcore events, in a set of cpus
+
+    :param cpuSet: A set of target cpu cores
+    :param eventSet: Collection of pmu request to be processed
+
+    """
+    cpuMask = [0] * (CPU_MAX // 64)
+    for cpu in cpuSet:
+      if cpu < 0 or cpu >= CPU_MAX:
+        raise Exception('cannot enable pmu in cpu {} - batch requests support up to {} cpus'.format(cpu, CPU_MAX))
+      cpuMask[cpu // 64] |= 1 << (cpu % 64)
+    return struct.pack('={}Q'.format(len(cpuMask)), *cpuMask) + PMUCtrl.buildRequestGroup(0, eventSet)
+
+  @staticmethod
+  def partitionCpus(cpuSet):
+    """
+    Partitions a cpu set, to cpus programmable with a batch request and cpus needing a request per cpu
+
+    :param cpuSet: A set of target cpu cores
+
+    """
+    batchCpus = sorted(cpu for cpu in cpuSet if cpu < CPU_MAX)
+    singleCpus = sorted(cpu for cpu in cpuSet if cpu >= CPU_MAX)
+    return batchCpus, singleCpus
+
+  @staticmethod
+  def parseBatchStatus(cpuSet, status):
+    """
+    Parses status of each cpu, for the last batch, returns a map of failed cpus to error codes
+
+    :param cpuSet: A set of target cpu cores
+    :param status: Status of a batch request, read from the device
+
+    """
+    codes = struct.unpack('={}i'.format(CPU_MAX), status)
+    return {cpu : codes[cpu] for cpu in cpuSet if codes[cpu] not in (0, CPU_SKIPPED)}
+
   @staticmethod
   def resolveEvents(eventsDb, cpuSet, events):
     """
@@ -151,17 +197,42 @@ class PMUCtrl(object):
       raise Exception('xpedite device not enabled - use "with PMUCtrl() as pmuCtrl:" to init device')
 
     eventSet = self.buildEventSet(self.eventsDb, cpuSet, events)
-    for cpu in cpuSet:
-      requestGroup = self.buildRequestGroup(cpu, eventSet)
-      LOGGER.debug(
-        'sending request (%d bytes) to xpedite ko [%s]',
-        len(requestGroup), ':'.join('{:02x}'.format(six.indexbytes(requestGroup, i))
-                                    for i in range(0, len(requestGroup)))
-      )
-      self.device.write(requestGroup)
-      self.device.flush()
+    batchCpus, singleCpus = self.partitionCpus(cpuSet)
+    failures = {}
+    if batchCpus:
+      request = self.buildBatchRequest(batchCpus, eventSet)
+      self.logRequest('batch', request)
+      try:
+        self.device.write(request)
+      except (IOError, OSError):
+        failures.update(self.parseBatchStatus(batchCpus, os.read(self.device.fileno(), CPU_MAX * 4)))
+    for cpu in singleCpus:
+      request = self.buildRequestGroup(cpu, eventSet)
+      self.logRequest('cpu {}'.format(cpu), request)
+      try:
+        self.device.write(request)
+      except (IOError, OSError) as ex:
+        failures[cpu] = -ex.errno if ex.errno else 'unknown'
+    if failures:
+      raise Exception('failed to enable pmu events in cpu(s) {}'.format(
+        ', '.join('{} (error {})'.format(cpu, code) for cpu, code in sorted(failures.items()))
+      ))
     return eventSet
 
+  @staticmethod
+  def logRequest(target, request):
+    """
+    Logs the bytes of a request to the xpedite device driver
+
+    :param target: Description of cpus targeted by the request
+    :param request: Serialized request
+
+    """
+    LOGGER.debug(
+      'sending %s request (%d bytes) to xpedite ko [%s]', target,
+      len(request), ':'.join('{:02x}'.format(six.indexbytes(request, i)) for i in range(0, len(request)))
+    )
+
   @staticmethod
   def buildPerfEventsRequest(eventsDb, events):
     """
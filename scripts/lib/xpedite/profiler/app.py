@@ -34,7 +34,7 @@ class XpediteApp(object):
 
   """
 
-  def __init__(self, name, ip, appInfoPath, dryRun=False, workspace=None):
+  def __init__(self, name, ip, appInfoPath, dryRun=False, workspace=None, streamSamples=False):
     """
     Constructs an instance of Xpediate App
 
@@ -46,6 +46,8 @@ class XpediteApp(object):
     :type appInfoPath: str
     :param dryRun: Flag to enable simulation of target application
     :type dryRun: bool
+    :param streamSamples: Flag to stream samples over tcp, in place of files in target host
+    :type streamSamples: bool
     """
 
     self.name = name
@@ -57,6 +59,8 @@ class XpediteApp(object):
     self.sampleFilePath = None
     self.workspace = workspace
     self.dataSource = None
+    self.streamSamples = streamSamples
+    self.samplesStream = None
 
   def __getattr__(self, name):
     if self.env:
@@ -79,9 +83,18 @@ class XpediteApp(object):
     """
     self.runId = int(time.time())
     self.sampleFilePath = '/dev/shm/xpedite-{}-{}-*.data'.format(self.name, self.runId)
+    cmd = 'BeginProfile --samplesFilePattern {} --pollInterval {} --samplesDataCapacity {}'
+    samplesFilePattern = self.sampleFilePath
+    if self.streamSamples:
+      import tempfile
+      from xpedite.transport.stream import SamplesStreamReceiver, localIpFor
+      streamDir = tempfile.mkdtemp(prefix='xpedite', suffix='Stream', dir='/tmp')
+      self.sampleFilePath = '{}/xpedite-{}-{}-multiplexed.data'.format(streamDir, self.name, self.runId)
+      self.samplesStream = SamplesStreamReceiver(self.sampleFilePath)
+      samplesFilePattern = self.samplesStream.endpoint(localIpFor(self.ip))
+      cmd += ' --samplesPersistence stream'
     rc = self.env.admin(
-      'BeginProfile --samplesFilePattern {} --pollInterval {} --samplesDataCapacity {}'.format(
-      self.sampleFilePath, pollInterval, samplesFileSize if samplesFileSize else 0), timeout)
+      cmd.format(samplesFilePattern, pollInterval, samplesFileSize if samplesFileSize else 0), timeout)
     if rc:
       errmsg = 'failed to begin profiling - {}'.format(rc)
       raise Exception(errmsg)
@@ -94,7 +107,22 @@ class XpediteApp(object):
     :param timeout: Maximum time to await a response from app (Default value = 10 seconds)
 
     """
-    return len(self.env.admin('EndProfile', timeout)) == 0
+    rc = len(self.env.admin('EndProfile', timeout)) == 0
+    if self.samplesStream:
+      rc &= self.samplesStream.stop(timeout)
+      self.samplesStream = None
+    return rc
+
+  def gatherFiles(self, pattern):
+    """
+    Gathers files matching pattern, from the local host for streamed samples, else from the target host
+
+    :param pattern: Wild card pattern for files to be collected
+
+    """
+    if self.streamSamples and pattern == self.sampleFilePath:
+      return Environment.gatherFiles(pattern)
+    return self.env.gatherFiles(pattern)
 
   def ping(self, keepAlive=False, timeout=10):
     """
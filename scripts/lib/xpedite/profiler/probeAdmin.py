@@ -36,23 +36,32 @@ class ProbeAdmin(object):
       return list(ProbeFactory(app.workspace).buildFromRecords(result.split('\n')).values())
     raise Exception('failed to query probes - have you instrumentd any xpedite probes in your binary ?')
 
+  # limits size of batched requests, to fit in a frame of the target process
+  MAX_CMD_SIZE = 4096
+
   @staticmethod
-  def _updateProbe(app, anchoredProbe, targetState):
+  def _updateProbes(app, anchoredProbes, targetState):
     """
-    Updates state of the given probe in the target process
+    Updates state of the given probes in the target process, batching probes in as few requests as possible
 
     :param app: Handle to an instance of the xpedite app
     :type app: xpedite.profiler.app.XpediteApp
-    :param anchoredProbe: The probe to activate/deactive
-    :type anchoredProbe: xpedite.types.probe.AnchoredProbe
-    :param targetState: Activation/deactivaatione flag for the given probe
+    :param anchoredProbes: The probes to activate/deactive
+    :param targetState: Activation/deactivaatione flag for the given probes
     :type targetState: bool
 
     """
-    probeFilePath = os.path.basename(anchoredProbe.filePath)
-    cmd = 'ActivateProbe' if targetState else 'DeactivateProbe'
-    cmd += ' --file {} --line {}'.format(probeFilePath, anchoredProbe.lineNo)
-    return app.admin(cmd, timeout=10)
+    req = 'ActivateProbe' if targetState else 'DeactivateProbe'
+    cmd = req
+    for anchoredProbe in anchoredProbes:
+      probeFilePath = os.path.basename(anchoredProbe.filePath)
+      arg = ' --file {} --line {}'.format(probeFilePath, anchoredProbe.lineNo)
+      if cmd != req and len(cmd) + len(arg) > ProbeAdmin.MAX_CMD_SIZE:
+        app.admin(cmd, timeout=10)
+        cmd = req
+      cmd += arg
+    if cmd != req:
+      app.admin(cmd, timeout=10)
 
   @staticmethod
   def updateProbes(app, anchoredProbes, targetState):
@@ -67,8 +76,7 @@ class ProbeAdmin(object):
 
     """
 
-    for probe in anchoredProbes:
-      ProbeAdmin._updateProbe(app, probe, targetState)
+    ProbeAdmin._updateProbes(app, anchoredProbes, targetState)
 
     errCount = 0
     errMsg = ''
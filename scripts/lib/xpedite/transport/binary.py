@@ -0,0 +1,249 @@
+"""
+Client for the binary request protocol of xpedite framework
+
+This module provides logic to
+  1. Encode requests in binary frames, with ids to pipeline requests
+  2. Batch probe keys, for activation/deactivation of probes in a single request
+  3. Decode binary responses, matching them to requests by id
+
+Binary and text frames can be interleaved in the same connection.
+The layout of frames must be kept in sync with include/xpedite/framework/BinaryProtocol.H
+
+Author: Manikandan Dhamodharan, Morgan Stanley
+"""
+
+import struct
+import logging
+from xpedite.transport.client import Client
+
+LOGGER = logging.getLogger(__name__)
+
+FRAME_MAGIC = 0xB5
+FRAME_VERSION = 1
+
+# magic (u8) | version (u8) | reserved (u16) | length (u32)
+FRAME_HEADER = struct.Struct('<BBHI')
+
+# requestId (u32) | opCode (u16)
+REQUEST_HEADER = struct.Struct('<IH')
+
+# requestId (u32) | returnCode (u8)
+RESPONSE_HEADER = struct.Struct('<IB')
+
+OP_TEXT = 0
+OP_ACTIVATE_PROBES = 1
+OP_DEACTIVATE_PROBES = 2
+OP_ACTIVATE_PERF_EVENTS = 3
+
+def encodeFrame(datagram):
+  """
+  Prefixes a datagram with a binary frame header
+
+  :param datagram: Encoded request
+  :type datagram: bytes
+
+  """
+  return FRAME_HEADER.pack(FRAME_MAGIC, FRAME_VERSION, 0, len(datagram)) + datagram
+
+def encodeString(value):
+  """Encodes a string as length (u32) followed by utf-8 characters"""
+  data = value.encode('utf-8')
+  return struct.pack('<I', len(data)) + data
+
+def encodeTextRequest(requestId, request):
+  """
+  Encodes a text request in a binary frame
+
+  :param requestId: Id of the request, echoed in the response
+  :param request: Request in text format
+
+  """
+  return encodeFrame(REQUEST_HEADER.pack(requestId, OP_TEXT) + request.encode('utf-8'))
+
+def encodeProbesRequest(requestId, probeKeys, targetState):
+  """
+  Encodes a batch of probe keys, for activation or deactivation in a single request
+
+  :param requestId: Id of the request, echoed in the response
+  :param probeKeys: A list of (name, file, line) tuples, identifying probes
+  :param targetState: Activation/deactivation flag for the given probes
+  :type targetState: bool
+
+  """
+  opCode = OP_ACTIVATE_PROBES if targetState else OP_DEACTIVATE_PROBES
+  body = REQUEST_HEADER.pack(requestId, opCode) + struct.pack('<I', len(probeKeys))
+  for name, fileName, line in probeKeys:
+    body += struct.pack('<I', line) + encodeString(fileName) + encodeString(name)
+  return encodeFrame(body)
+
+def encodePerfEventsRequest(requestId, requestGroups, rotationPeriodMs=0, isStaggered=False):
+  """
+  Encodes a request to enable groups of perf events, multiplexed every rotation period
+
+  Profiles name the events of the first group only, samples of other groups are tagged
+  with their group id and are excluded from pmc deltas of timelines (see analytics.timeline)
+
+  :param requestId: Id of the request, echoed in the response
+  :param requestGroups: A list of raw PMUCtlRequest objects (see PMUCtrl.buildRequestGroup)
+  :param rotationPeriodMs: Period in milli seconds, for rotation of multiplexed groups
+  :param isStaggered: Flag to stagger the groups across threads
+
+  """
+  if not requestGroups or len(requestGroups) > 255:
+    raise Exception('invalid perf events request - expected 1 to 255 groups, got {}'.format(len(requestGroups)))
+  body = REQUEST_HEADER.pack(requestId, OP_ACTIVATE_PERF_EVENTS)
+  body += struct.pack('<IBB', rotationPeriodMs, int(isStaggered), len(requestGroups))
+  for requestGroup in requestGroups:
+    body += requestGroup
+  return encodeFrame(body)
+
+class BinaryResponse(object):
+  """Response of a binary request"""
+
+  def __init__(self, requestId, returnCode, payload):
+    self.requestId = requestId
+    self.returnCode = returnCode
+    self.payload = payload
+
+  def __repr__(self):
+    return 'BinaryResponse - requestId {} | rc {} | payload |{}|'.format(self.requestId, self.returnCode, self.payload)
+
+class BinaryClient(Client):
+  """
+  Client to pipeline binary requests to the target application
+
+  Requests are tagged with monotonically increasing ids. Responses are matched to
+  requests by id, hence many requests can be sent, before awaiting any responses.
+  """
+
+  def __init__(self, host, port):
+    Client.__init__(self, host, port)
+    self.nextRequestId = 1
+    self.pendingResponses = {}
+
+  def connect(self):
+    """Establishes connection to the remote end"""
+    import socket
+    Client.connect(self)
+    self.socket.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, True)
+
+  def allocateRequestId(self):
+    """Returns a fresh id for the next request"""
+    requestId = self.nextRequestId
+    self.nextRequestId = (self.nextRequestId + 1) & 0xFFFFFFFF or 1
+    return requestId
+
+  def sendText(self, request):
+    """
+    Sends a text request in a binary frame, returns id of the request
+
+    :param request: Request in text format
+
+    """
+    requestId = self.allocateRequestId()
+    self.socket.sendall(encodeTextRequest(requestId, request))
+    return requestId
+
+  def sendProbes(self, probeKeys, targetState):
+    """
+    Sends a batch of probe keys for activation/deactivation, returns id of the request
+
+    :param probeKeys: A list of (name, file, line) tuples, identifying probes
+    :param targetState: Activation/deactivation flag for the given probes
+
+    """
+    requestId = self.allocateRequestId()
+    self.socket.sendall(encodeProbesRequest(requestId, probeKeys, targetState))
+    return requestId
+
+  def sendPerfEvents(self, requestGroups, rotationPeriodMs=0, isStaggered=False):
+    """
+    Sends a request to enable groups of perf events, returns id of the request
+
+    :param requestGroups: A list of raw PMUCtlRequest objects
+    :param rotationPeriodMs: Period in milli seconds, for rotation of multiplexed groups
+    :param isStaggered: Flag to stagger the groups across threads
+
+    """
+    requestId = self.allocateRequestId()
+    self.socket.sendall(encodePerfEventsRequest(requestId, requestGroups, rotationPeriodMs, isStaggered))
+    return requestId
+
+  def readExactly(self, length, timeout):
+    """Reads exactly length bytes from the socket, till timeout"""
+    data = b''
+    while len(data) < length:
+      block = self.receive(length - len(data), timeout)
+      if not block:
+        raise Exception('socket closed - failed to read datagram')
+      data += block
+    return data
+
+  def readResponse(self, timeout=60):
+    """
+    Reads the next response from the socket
+
+    Text responses are sent by the target, for connections rejected before reading requests
+    and are returned with a request id of None
+
+    :param timeout: Max amount to time to await for incoming data (Default value = 60)
+
+    """
+    header = self.readExactly(FRAME_HEADER.size, timeout)
+    magic, version, _, length = FRAME_HEADER.unpack(header)
+    if magic != FRAME_MAGIC:
+      datagram = self.readExactly(int(header), timeout).decode('utf-8')
+      if len(datagram) < 5 or datagram[4] != '|' or not datagram[3].isdigit():
+        raise Exception('Invalid response - pdu not in expected format \n{}\n'.format(datagram))
+      return BinaryResponse(None, int(datagram[3]), datagram[5:])
+    if version != FRAME_VERSION:
+      raise Exception('Invalid response - unsupported binary frame version {}'.format(version))
+    datagram = self.readExactly(length, timeout)
+    if len(datagram) < RESPONSE_HEADER.size:
+      raise Exception('Invalid response - truncated binary response of {} bytes'.format(len(datagram)))
+    requestId, returnCode = RESPONSE_HEADER.unpack_from(datagram)
+    payload = datagram[RESPONSE_HEADER.size:].decode('utf-8')
+    LOGGER.debug('Received response for request %d - rc %d', requestId, returnCode)
+    return BinaryResponse(requestId, returnCode, payload)
+
+  def awaitResponse(self, requestId, timeout=60):
+    """
+    Awaits the response of a request, buffering responses of other pipelined requests
+
+    :param requestId: Id of the request to await
+    :param timeout: Max amount to time to await for incoming data (Default value = 60)
+
+    """
+    while requestId not in self.pendingResponses:
+      response = self.readResponse(timeout)
+      if response.requestId is None:
+        raise Exception('Failed to execute request - {}'.format(response.payload))
+      self.pendingResponses[response.requestId] = response
+    return self.pendingResponses.pop(requestId)
+
+  def admin(self, request, timeout=10):
+    """
+    Sends a text request and awaits the result, raising an exception on failure
+
+    :param request: Request in text format
+    :param timeout: Maximum time to await a response from app (Default value = 10 seconds)
+
+    """
+    response = self.awaitResponse(self.sendText(request), timeout)
+    if response.returnCode:
+      raise Exception('Failed to execute request - {}'.format(response.payload))
+    return response.payload
+
+  def updateProbes(self, probeKeys, targetState, timeout=10):
+    """
+    Activates/deactivates a batch of probes with a single request
+
+    :param probeKeys: A list of (name, file, line) tuples, identifying probes
+    :param targetState: Activation/deactivation flag for the given probes
+    :param timeout: Maximum time to await a response from app (Default value = 10 seconds)
+
+    """
+    response = self.awaitResponse(self.sendProbes(probeKeys, targetState), timeout)
+    if response.returnCode:
+      raise Exception('Failed to update probes - {}'.format(response.payload))
+    return response.payload
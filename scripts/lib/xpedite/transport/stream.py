@@ -0,0 +1,90 @@
+"""
+Receiver for samples streamed by the target application
+
+The receiver listens for a tcp connection from the xpedite framework, and incrementally
+appends the streamed samples to a local multiplexed samples file, as the data arrives.
+The stream has the same layout as a multiplexed samples file, hence the file can be
+loaded, with no changes to the samples loader.
+
+Author: Manikandan Dhamodharan, Morgan Stanley
+"""
+
+import socket
+import logging
+import threading
+
+LOGGER = logging.getLogger(__name__)
+
+class SamplesStreamReceiver(object):
+  """Accepts a samples stream and persists it to a local file, in a background thread"""
+
+  CHUNK_SIZE = 1024 * 1024
+
+  def __init__(self, filePath, ip='', port=0):
+    """
+    Constructs a receiver, listening for samples stream at the given address
+
+    :param filePath: Path of the local file, to persist the streamed samples
+    :param ip: Address of the interface to listen on (Default value = all interfaces)
+    :param port: Port to listen on (Default value = 0, for an ephemeral port)
+
+    """
+    self.filePath = filePath
+    self.size = 0
+    self.listener = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    self.listener.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    self.listener.bind((ip, port))
+    self.listener.listen(1)
+    self.port = self.listener.getsockname()[1]
+    self.thread = threading.Thread(target=self.run, name='xpediteSamplesStream')
+    self.thread.daemon = True
+    self.thread.start()
+    LOGGER.debug('listening for samples stream at port %d -> %s', self.port, filePath)
+
+  def endpoint(self, ip):
+    """Returns the endpoint, for the target application to connect to"""
+    return '{}:{}'.format(ip, self.port)
+
+  def run(self):
+    """Receives samples till the target application closes the stream"""
+    try:
+      connection, address = self.listener.accept()
+      LOGGER.debug('accepted samples stream from %s', address)
+      with open(self.filePath, 'wb') as dataFile:
+        while True:
+          data = connection.recv(self.CHUNK_SIZE)
+          if not data:
+            break
+          dataFile.write(data)
+          self.size += len(data)
+      connection.close()
+    except socket.error as ex:
+      LOGGER.error('failed to receive samples stream - %s', ex)
+    finally:
+      self.listener.close()
+
+  def stop(self, timeout=10):
+    """
+    Awaits the end of the samples stream
+
+    :param timeout: Maximum time to await the end of stream (Default value = 10 seconds)
+
+    """
+    self.thread.join(timeout)
+    if self.thread.is_alive():
+      LOGGER.error('timed out awaiting end of samples stream - received %d bytes', self.size)
+      self.listener.close()
+      return False
+    LOGGER.info('received samples stream - %d bytes -> %s', self.size, self.filePath)
+    return True
+
+def localIpFor(ip):
+  """Returns the address of the local interface, used to reach the given ip"""
+  if ip.lower() in ('localhost', '127.0.0.1'):
+    return '127.0.0.1'
+  probe = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+  try:
+    probe.connect((ip, 9))
+    return probe.getsockname()[0]
+  finally:
+    probe.close()
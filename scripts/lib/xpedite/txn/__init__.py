@@ -18,6 +18,9 @@ class Transaction(object):
 
   A transaction stores data (timestamps and h/w counters) from a collection of probes, that got hit, during program
   execution to achieve the functionality.
+
+  Transactions built natively, carry elapsed tsc, pmc deltas (last - first counter) and tsc deltas
+  between consecutive counters, computed by the samples loader (None for transactions built in python)
   """
 
   def __init__(self, counter, txnId):
@@ -28,6 +31,9 @@ class Transaction(object):
     self.begin = None
     self.end = None
     self.hasEndProbe = False
+    self.elapsedTsc = None
+    self.pmcDeltas = None
+    self.probeDeltas = None
 
   def addCounter(self, counter, isEndProbe):
     """
@@ -48,6 +54,7 @@ class Transaction(object):
 
     """
     self.counters = sorted(self.counters + other.counters, key=lambda counter: counter.tsc)
+    self.elapsedTsc = self.pmcDeltas = self.probeDeltas = None
 
   def hasProbe(self, probe):
     """
@@ -93,6 +100,8 @@ class Transaction(object):
 
   def getElapsedTsc(self):
     """Computes the elapsed time for this transaction"""
+    if self.elapsedTsc is not None:
+      return self.elapsedTsc
     return self.end.tsc - self.begin.tsc
 
   def finalize(self):
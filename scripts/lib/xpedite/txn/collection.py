@@ -11,13 +11,14 @@ from collections  import OrderedDict
 class TxnSubCollection(object):
   """A subset of transactions in a transaction collection"""
 
-  def __init__(self, name, cpuInfo, transactions, probes, topdownMetrics, events):
+  def __init__(self, name, cpuInfo, transactions, probes, topdownMetrics, events, probeOverhead=None):
     self.name = name
     self.cpuInfo = cpuInfo
     self.transactions = transactions
     self.probes = probes
     self.topdownMetrics = topdownMetrics
     self.events = events
+    self.probeOverhead = probeOverhead
 
   def __getitem__(self, index):
     return self.transactions[index]
@@ -36,7 +37,9 @@ class TxnSubCollection(object):
 
   def cloneMetaData(self):
     """Creates a empty sub collection object with cloned meta data"""
-    return TxnSubCollection(self.name, self.cpuInfo, [], self.probes, self.topdownMetrics, self.events)
+    return TxnSubCollection(
+      self.name, self.cpuInfo, [], self.probes, self.topdownMetrics, self.events, self.probeOverhead
+    )
 
   def __eq__(self, other):
     return self.__dict__ == other.__dict__
@@ -44,7 +47,7 @@ class TxnSubCollection(object):
 class TxnCollection(object):
   """A collection of transactions sharing a common route"""
 
-  def __init__(self, name, cpuInfo, txnMap, probes, topdownMetrics, events, dataSource):
+  def __init__(self, name, cpuInfo, txnMap, probes, topdownMetrics, events, dataSource, probeOverhead=None):
     self.name = name
     self.cpuInfo = cpuInfo
     for txn in txnMap.values():
@@ -56,12 +59,14 @@ class TxnCollection(object):
     self.topdownMetrics = topdownMetrics
     self.events = events
     self.dataSource = dataSource
+    self.probeOverhead = probeOverhead
     self.repo = None
 
   def getSubCollection(self):
     """Builds an instance of transaction sub collection"""
     return TxnSubCollection(
-      self.name, self.cpuInfo, list(self.txnMap.values()), self.probes, self.topdownMetrics, self.events
+      self.name, self.cpuInfo, list(self.txnMap.values()), self.probes, self.topdownMetrics, self.events,
+      self.probeOverhead
     )
 
   def isCurrent(self):
@@ -102,7 +102,7 @@ class Collector(Extractor):
 
   def loadSamples(self, loader, probes, path):
     """
-    Loads counters for a profile session from csv sample files
+    Loads counters for a profile session from csv or columnar sample files
 
     :param loader: Loader to build transactions out of the counters
     :param probes: A list of probes associated with samples in a file
@@ -111,7 +111,13 @@ class Collector(Extractor):
     """
     recordCount = 0
     reportDirs = list(sorted(os.listdir(path)))
+    for fileName in fnmatch.filter(reportDirs, '*' + self.COLUMNAR_FILE_SUFFIX):
+      fields = fileName[:-len(self.COLUMNAR_FILE_SUFFIX)].split('-')
+      threadInfo = tuple(fields) if len(fields) == 2 and all(f.isalnum() for f in fields) else None
+      recordCount += self.loadColumnarCounters(loader, probes, os.path.join(path, fileName), threadInfo)
     for threadInfo in reportDirs:
+      if threadInfo.endswith(self.COLUMNAR_FILE_SUFFIX) or threadInfo.endswith(self.TXN_FILE_SUFFIX):
+        continue
       fields = threadInfo.split('-')
       if len(fields) < 2:
         raise Exception('Datasource {} missing tls storage info {}\n'.format(reportDirs, threadInfo))
@@ -154,6 +160,12 @@ class Collector(Extractor):
     with open(path) as fileHandle:
       recordCount = 0
       for record in fileHandle:
+        if record.startswith(self.OVERHEAD_RECORD_PREFIX):
+          loader.loadProbeOverhead(self.parseProbeOverhead(record))
+          continue
+        if record.startswith(self.TSC_CALIBRATION_RECORD_PREFIX):
+          loader.loadTscCalibration(self.parseTscHz(record))
+          continue
         if recordCount > 0:
           self.loadCounter(threadId, loader, probes, record)
         recordCount += 1
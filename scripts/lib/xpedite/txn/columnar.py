@@ -0,0 +1,141 @@
+"""
+Loader for samples in columnar layout
+
+The samples loader (xpediteSamplesLoader --columnar) writes samples as a struct of arrays,
+with a table of threads, identifying the contiguous range of rows captured by each thread.
+This module maps the columns to numpy arrays, without parsing any of the records.
+
+Refer to bin/ColumnarWriter.H for the layout of columnar files.
+Tsc values are aligned across sockets and the header holds the refined tsc frequency.
+
+Author: Manikandan Dhamodharan, Morgan Stanley
+"""
+
+import binascii
+import struct
+from xpedite.types import ProbeOverhead
+
+class ColumnarSamples(object):
+  """Columns of samples, loaded from a columnar file"""
+
+  SIGNATURE = 0xC01DC01DC0FFEEC0
+  VERSION = 0x0103
+  HEADER_FORMAT = '<QIIQQIIQII11Q'
+  THREAD_FORMAT = '<IIQQQ'
+  FLAG_DATA = 1
+  FLAG_PMC = 2
+  FLAG_PAYLOAD = 4
+
+  def __init__(self, path):
+    """
+    Maps columns of the given columnar file
+
+    :param path: Path of the columnar file
+
+    """
+    import numpy
+    headerSize = struct.calcsize(self.HEADER_FORMAT)
+    threadSize = struct.calcsize(self.THREAD_FORMAT)
+    with open(path, 'rb') as fileHandle:
+      header = struct.unpack(self.HEADER_FORMAT, fileHandle.read(headerSize))
+      (signature, version, self.pmcCount, self.tscHz, self.rowCount, threadCount, _) = header[:7]
+      if signature != self.SIGNATURE or version != self.VERSION:
+        raise Exception('detected invalid columnar file {} - signature {:x} | version {:x}'.format(
+          path, signature, version))
+      self.threads = [struct.unpack(self.THREAD_FORMAT, fileHandle.read(threadSize)) for _ in range(threadCount)]
+      self.threads = [(tid, tlsAddr, rowBegin, rowCount) for (tid, _, tlsAddr, rowBegin, rowCount) in self.threads]
+      (overheadCycles, overheadPmcCount, overheadPmcGroup) = header[7:10]
+      overheadPmcs = list(header[10:10 + overheadPmcCount])
+      self.probeOverhead = ProbeOverhead(overheadCycles, overheadPmcs, overheadPmcGroup) if overheadCycles else None
+
+    rows = self.rowCount
+    buf = numpy.memmap(path, dtype=numpy.uint8, mode='r')
+    offset = [headerSize + threadSize * threadCount]
+    def column(dtype, count=rows):
+      """Maps the next column in the file"""
+      array = numpy.frombuffer(buf, dtype=dtype, count=count, offset=offset[0])
+      offset[0] += array.nbytes
+      return array
+
+    self.tsc = column('<u8')
+    self.returnSite = column('<u8')
+    self.dataLo = column('<u8')
+    self.dataHi = column('<u8')
+    self.pmc = column('<u8', rows * self.pmcCount).reshape(self.pmcCount, rows)
+    self.flags = column('u1')
+    self.pmcGroup = column('u1')
+    offset[0] = (offset[0] + 7) // 8 * 8
+    self.payloadOffset = column('<u8', rows + 1)
+    self.payload = column('u1', int(self.payloadOffset[-1]))
+
+  def columns(self, rowBegin, rowEnd):
+    """
+    Returns columns of a range of rows, as views of the mapped file
+
+    :param rowBegin: Index of the first row
+    :param rowEnd: Index of the row, past the end of the range
+
+    """
+    return SampleColumns(self, rowBegin, rowEnd)
+
+class SampleColumns(object):
+  """
+  Columns of a contiguous range of rows in a columnar file
+
+  Columns are views of the mapped file, letting the txn layer select rows with
+  vectorized operations and build counters, only for the rows selected
+  """
+
+  def __init__(self, samples, rowBegin, rowEnd):
+    self.rowBegin = rowBegin
+    self.tsc = samples.tsc[rowBegin:rowEnd]
+    self.returnSite = samples.returnSite[rowBegin:rowEnd]
+    self.dataLo = samples.dataLo[rowBegin:rowEnd]
+    self.dataHi = samples.dataHi[rowBegin:rowEnd]
+    self.pmc = samples.pmc[:, rowBegin:rowEnd]
+    self.flags = samples.flags[rowBegin:rowEnd]
+    self.pmcGroup = samples.pmcGroup[rowBegin:rowEnd]
+    self.payloadOffset = samples.payloadOffset[rowBegin:rowEnd + 1]
+    self.payload = samples.payload
+
+  def __len__(self):
+    return len(self.tsc)
+
+  def selectProbes(self, probes):
+    """
+    Returns a mask of rows, with return sites of the given probes
+
+    :param probes: Map of probes, keyed by return site (formatted in hex)
+
+    """
+    import numpy
+    returnSites = numpy.array([int(addr, 16) for addr in probes], dtype=numpy.uint64)
+    return numpy.isin(self.returnSite, returnSites)
+
+  def formatReturnSites(self, rows):
+    """
+    Returns return sites of the given rows, formatted as in text records of the samples loader
+
+    :param rows: Indices of rows, relative to the beginning of the range
+
+    """
+    return ['0x{:x}'.format(returnSite) for returnSite in self.returnSite[rows].tolist()]
+
+  def formatData(self, rows):
+    """
+    Returns data and payloads of the given rows, formatted as in text records of the samples loader
+
+    Only rows with data or payloads are formatted, other rows have empty strings
+
+    :param rows: Indices of rows, relative to the beginning of the range
+
+    """
+    import numpy
+    data = [''] * len(rows)
+    flags = self.flags[rows]
+    for i in numpy.nonzero(flags & ColumnarSamples.FLAG_DATA)[0].tolist():
+      data[i] = '{:x}{:016x}'.format(int(self.dataHi[rows[i]]), int(self.dataLo[rows[i]]))
+    for i in numpy.nonzero(flags & ColumnarSamples.FLAG_PAYLOAD)[0].tolist():
+      (begin, end) = self.payloadOffset[rows[i]:rows[i] + 2].tolist()
+      data[i] = binascii.hexlify(self.payload[begin:end].tobytes()).decode('ascii')
+    return data
@@ -7,15 +7,29 @@ probes in the target application.
 Each such decoded record is inturn used to construct a Counter object for
 transaction building.
 
+Samples files are either per thread or multiplexed with segments from all threads.
+
+Setting the environment variable XPEDITE_COLUMNAR_SAMPLES, switches the decoder to
+columnar output, replacing parsing of text records, with arrays mapped from a binary file.
+In columnar mode, transactions bounded by begin/end probes are built natively by the decoder.
+
+The overhead of probes, calibrated by the framework at the start of a profile, is loaded
+from a record following the header of text records, or from the header of columnar files.
+
+The frequency of time stamp counters, refined by the decoder over the span of the profile,
+is loaded the same way, to replace the frequency in cpu info. Tsc values decoded from
+threads in different sockets, are aligned by the decoder, using the measured socket offsets.
+
 Author: Manikandan Dhamodharan, Morgan Stanley
 """
 
 import os
 import re
 import time
+import struct
 import logging
 import subprocess
-from xpedite.types      import Counter, DataSource
+from xpedite.types      import Counter, DataSource, ProbeOverhead
 from xpedite.util       import makeLogPath, mkdir
 
 LOGGER = logging.getLogger(__name__)
@@ -55,54 +69,302 @@ class Extractor(object):
     dataSource = DataSource(app.appInfoPath, samplePath)
     loader.beginCollection(dataSource)
 
+    columnar = bool(os.environ.get(self.COLUMNAR_SAMPLES_ENV))
+    loadSamplesFile = self.loadColumnarSamplesFile if columnar else self.loadSamplesFile
     for filePath in filePaths:
-      (threadId, tlsAddr) = self.extractThreadInfo(filePath)
-      if not threadId or not tlsAddr:
-        raise Exception('failed to extract thread info for file {}'.format(filePath))
-      LOGGER.info('loading counters for thread %s from file %s -> ', threadId, filePath)
-
-      iterBegin = begin = time.time()
-      loader.beginLoad(threadId, tlsAddr)
-      inflateFd = self.openInflateFile(samplePath, threadId, tlsAddr)
-      extractor = subprocess.Popen([self.samplesLoader, filePath],
-        bufsize=2*1024*1024, stdout=subprocess.PIPE, stderr=subprocess.PIPE, universal_newlines=True)
-      recordCount = 0
-      while True:
-        record = extractor.stdout.readline()
-        if record.strip() == '':
-          if extractor.poll() is not None:
-            errmsg = extractor.stderr.read()
-            if errmsg:
-              raise Exception('failed to load {} - {}'.format(filePath, errmsg))
-          break
-        if inflateFd:
-          inflateFd.write(record)
-        if recordCount > 0:
-          self.loadCounter(threadId, loader, app.probes, record)
-          elapsed = time.time() - iterBegin
-          if elapsed >= 5:
-            LOGGER.completed('\tprocessed %d counters | ', recordCount-1)
-            iterBegin = time.time()
-        recordCount += 1
-      loader.endLoad()
-      if inflateFd:
-        inflateFd.close()
-      elapsed = time.time() - begin
-      self.logCounterFilterReport()
-      if self.orphanedRecords:
-        LOGGER.warn('detected mismatch in binary vs app info - %d counters ignored', len(self.orphanedRecords))
-      LOGGER.completed('%d records | %d txns loaded in %0.2f sec.', recordCount-1, loader.getCount(), elapsed)
+      if self.isMultiplexed(filePath):
+        LOGGER.info('loading counters for all threads from multiplexed file %s -> ', filePath)
+        loadSamplesFile(app, loader, samplePath, filePath)
+      else:
+        threadInfo = self.extractThreadInfo(filePath)
+        if not threadInfo[0] or not threadInfo[1]:
+          raise Exception('failed to extract thread info for file {}'.format(filePath))
+        LOGGER.info('loading counters for thread %s from file %s -> ', threadInfo[0], filePath)
+        loadSamplesFile(app, loader, samplePath, filePath, threadInfo)
     if loader.isCompromised() or loader.getTxnCount() <= 0:
       LOGGER.warn(loader.report())
     elif loader.isNotAccounted():
       LOGGER.debug(loader.report())
     loader.endCollection()
 
+  def loadSamplesFile(self, app, loader, samplePath, filePath, threadInfo=None):
+    """
+    Loads time and pmu counters from a samples file
+
+    Records of multiplexed files are grouped by thread, with each group preceded by
+    a thread record, carrying the thread id and thread local storage address
+
+    :param app: Handle to the instance of the xpedite app
+    :param loader: Loader to build transactions out of the counters
+    :param samplePath: Path of the data source directory
+    :param filePath: Path of the samples file
+    :param threadInfo: Id and tls address of thread for per thread samples files
+
+    """
+    inflateFd = self.beginThread(loader, samplePath, threadInfo) if threadInfo else None
+    iterBegin = begin = time.time()
+    extractor = subprocess.Popen([self.samplesLoader, filePath],
+      bufsize=2*1024*1024, stdout=subprocess.PIPE, stderr=subprocess.PIPE, universal_newlines=True)
+    recordCount = 0
+    while True:
+      record = extractor.stdout.readline()
+      if record.strip() == '':
+        if extractor.poll() is not None:
+          errmsg = extractor.stderr.read()
+          if errmsg:
+            raise Exception('failed to load {} - {}'.format(filePath, errmsg))
+        break
+      if record.startswith(self.THREAD_RECORD_PREFIX):
+        if threadInfo:
+          self.endThread(loader, inflateFd, recordCount, begin)
+        threadInfo = tuple(record.strip().split(',')[1:3])
+        LOGGER.info('loading counters for thread %s -> ', threadInfo[0])
+        inflateFd = self.beginThread(loader, samplePath, threadInfo)
+        iterBegin = begin = time.time()
+        recordCount = 0
+        continue
+      if inflateFd:
+        inflateFd.write(record)
+      if record.startswith(self.OVERHEAD_RECORD_PREFIX):
+        loader.loadProbeOverhead(self.parseProbeOverhead(record))
+        continue
+      if record.startswith(self.TSC_CALIBRATION_RECORD_PREFIX):
+        loader.loadTscCalibration(self.parseTscHz(record))
+        continue
+      if recordCount > 0:
+        self.loadCounter(threadInfo[0], loader, app.probes, record)
+        elapsed = time.time() - iterBegin
+        if elapsed >= 5:
+          LOGGER.completed('\tprocessed %d counters | ', recordCount-1)
+          iterBegin = time.time()
+      recordCount += 1
+    if threadInfo:
+      self.endThread(loader, inflateFd, recordCount, begin)
+
+  def loadColumnarSamplesFile(self, app, loader, samplePath, filePath, threadInfo=None):
+    """
+    Loads time and pmu counters from a samples file, decoded to columnar layout
+
+    The columnar file is retained in the data source directory, named after the thread
+    for per thread samples files, to support reloading of the profile session
+
+    :param app: Handle to the instance of the xpedite app
+    :param loader: Loader to build transactions out of the counters
+    :param samplePath: Path of the data source directory
+    :param filePath: Path of the samples file
+    :param threadInfo: Id and tls address of thread for per thread samples files
+
+    """
+    mkdir(samplePath)
+    name = '{}-{}'.format(*threadInfo) if threadInfo else os.path.basename(filePath)
+    columnarPath = os.path.join(samplePath, '{}{}'.format(name, self.COLUMNAR_FILE_SUFFIX))
+    txnPath = os.path.join(samplePath, '{}{}'.format(name, self.TXN_FILE_SUFFIX))
+    extractor = subprocess.Popen([self.samplesLoader, '--columnar', columnarPath, '--txns', txnPath,
+      '--appinfo', app.appInfoPath, filePath],
+      stdout=subprocess.PIPE, stderr=subprocess.PIPE, universal_newlines=True)
+    _, errmsg = extractor.communicate()
+    if extractor.returncode != 0:
+      raise Exception('failed to load {} - {}'.format(filePath, errmsg))
+    return self.loadColumnarCounters(loader, app.probes, columnarPath, threadInfo)
+
+  def loadColumnarCounters(self, loader, probes, path, threadInfo=None):
+    """
+    Loads time and pmu counters for all threads in a columnar file
+
+    Transactions built natively, are loaded from a txn file next to the columnar file,
+    unless the loader groups counters by txn id, counters are filtered, or transactions
+    span threads (suspended and resumed), needing the loader to join fragments
+
+    :param loader: Loader to build transactions out of the counters
+    :param probes: Map of probes instrumented in target application
+    :param path: Path of the columnar file
+    :param threadInfo: Id and tls address of thread, overriding the thread table of the file
+
+    """
+    from xpedite.txn.columnar import ColumnarSamples
+    from xpedite.txn.filter import TrivialCounterFilter
+    samples = ColumnarSamples(path)
+    if samples.probeOverhead:
+      loader.loadProbeOverhead(samples.probeOverhead)
+    loader.loadTscCalibration(samples.tscHz)
+    txns = None
+    txnPath = path[:-len(self.COLUMNAR_FILE_SUFFIX)] + self.TXN_FILE_SUFFIX
+    if (os.path.isfile(txnPath) and hasattr(loader, 'loadTxn')
+        and isinstance(self.counterFilter, TrivialCounterFilter)):
+      from xpedite.txn.native import NativeTxns
+      txns = NativeTxns(txnPath)
+      if txns.isFragmented or txns.rowCount != samples.rowCount:
+        txns = None
+    recordCount = 0
+    if txns:
+      loader.beginNativeTxns()
+    for threadIndex, (tid, tlsAddr, rowBegin, rowCount) in enumerate(samples.threads):
+      begin = time.time()
+      (threadId, tlsAddr) = threadInfo if threadInfo else (str(tid), '{:016x}'.format(tlsAddr))
+      LOGGER.info('loading counters for thread %s -> ', threadId)
+      loader.beginLoad(threadId, tlsAddr)
+      columns = samples.columns(rowBegin, rowBegin + rowCount)
+      isKnown = columns.selectProbes(probes)
+      self.loadOrphanedRecords(columns, isKnown)
+      if txns:
+        self.loadNativeTxns(loader, probes, columns, isKnown, txns, threadIndex, threadId)
+      else:
+        import numpy
+        for counter in self.buildCounters(probes, threadId, columns, numpy.nonzero(isKnown)[0]):
+          if self.counterFilter.canLoad(counter):
+            loader.loadCounter(counter)
+      self.endThread(loader, None, rowCount + 1, begin)
+      recordCount += rowCount
+    return recordCount
+
+  def loadOrphanedRecords(self, columns, isKnown):
+    """
+    Records rows of a thread, with return sites not matching any of the probes
+
+    :param columns: Columns of samples of the thread
+    :param isKnown: Mask of rows, with return sites of known probes
+
+    """
+    import numpy
+    rows = numpy.nonzero(~isKnown)[0]
+    self.orphanedRecords.extend(zip(columns.tsc[rows].tolist(), columns.formatReturnSites(rows)))
+
+  @staticmethod
+  def buildCounters(probes, threadId, columns, rows):
+    """
+    Builds counters for the given rows of columns
+
+    :param probes: Map of probes instrumented in target application
+    :param threadId: Id of the thread, that captured the samples
+    :param columns: Columns of samples of the thread
+    :param rows: Indices of rows, with return sites of known probes
+
+    """
+    from xpedite.txn.columnar import ColumnarSamples
+    tscs = columns.tsc[rows].tolist()
+    addrs = columns.formatReturnSites(rows)
+    data = columns.formatData(rows)
+    hasPmcs = (columns.flags[rows] & ColumnarSamples.FLAG_PMC).tolist()
+    pmcGroups = columns.pmcGroup[rows].tolist()
+    pmcs = columns.pmc[:, rows].T.tolist()
+    counters = []
+    for i, tsc in enumerate(tscs):
+      counter = Counter(threadId, probes[addrs[i]], data[i], tsc)
+      if hasPmcs[i]:
+        counter.pmcGroup = pmcGroups[i]
+        for pmc in pmcs[i]:
+          counter.addPmc(pmc)
+      counters.append(counter)
+    return counters
+
+  def loadNativeTxns(self, loader, probes, columns, isKnown, txns, threadIndex, threadId):
+    """
+    Loads transactions, built natively for a thread
+
+    Counters are built only for rows of transactions, rows outside of transactions are accounted extraneous
+
+    :param loader: Loader to build transactions out of the counters
+    :param probes: Map of probes instrumented in target application
+    :param columns: Columns of samples of the thread
+    :param isKnown: Mask of rows, with return sites of known probes
+    :param txns: Transactions built natively
+    :param threadIndex: Index of the thread in the columnar file
+    :param threadId: Id of the thread, that captured the samples
+
+    """
+    import numpy
+    rowBegin = columns.rowBegin
+    txnCounterCount = 0
+    for (txnId, txnBegin, txnEnd, elapsedTsc, pmcDeltas) in txns.threadTxns(threadIndex):
+      rows = numpy.nonzero(isKnown[txnBegin - rowBegin:txnEnd - rowBegin])[0] + (txnBegin - rowBegin)
+      if len(rows):
+        counters = self.buildCounters(probes, threadId, columns, rows)
+        probeDeltas = txns.probeDeltas(rows + rowBegin)
+        loader.loadTxn(counters, txnId, elapsedTsc, pmcDeltas, probeDeltas)
+      txnCounterCount += len(rows)
+    loader.skipNonTxnCounters(int(numpy.count_nonzero(isKnown)) - txnCounterCount)
+
+  def beginThread(self, loader, samplePath, threadInfo):
+    """
+    Begins loading of counters for a thread
+
+    :param loader: Loader to build transactions out of the counters
+    :param samplePath: Path of the data source directory
+    :param threadInfo: Id and tls address of thread collecting the samples
+
+    """
+    (threadId, tlsAddr) = threadInfo
+    loader.beginLoad(threadId, tlsAddr)
+    return self.openInflateFile(samplePath, threadId, tlsAddr)
+
+  def endThread(self, loader, inflateFd, recordCount, begin):
+    """
+    Ends loading of counters for a thread
+
+    :param loader: Loader to build transactions out of the counters
+    :param inflateFd: Handle to the data source file of the thread
+    :param recordCount: Count of records loaded for the thread
+    :param begin: Time at the begining of load
+
+    """
+    loader.endLoad()
+    if inflateFd:
+      inflateFd.close()
+    elapsed = time.time() - begin
+    self.logCounterFilterReport()
+    if self.orphanedRecords:
+      LOGGER.warn('detected mismatch in binary vs app info - %d counters ignored', len(self.orphanedRecords))
+    LOGGER.completed('%d records | %d txns loaded in %0.2f sec.', recordCount-1, loader.getCount(), elapsed)
+
+  @staticmethod
+  def isMultiplexed(filePath):
+    """
+    Checks the signature in file header, to detect multiplexed samples files
+
+    :param filePath: Path of the samples file
+
+    """
+    with open(filePath, 'rb') as fileHandle:
+      header = fileHandle.read(8)
+    return len(header) == 8 and struct.unpack('<Q', header)[0] == Extractor.MULTIPLEXED_FILE_SIGNATURE
+
+  THREAD_RECORD_PREFIX = 'Thread,'
+  OVERHEAD_RECORD_PREFIX = 'Overhead,'
+  TSC_CALIBRATION_RECORD_PREFIX = 'TscCalibration,'
+  COLUMNAR_SAMPLES_ENV = 'XPEDITE_COLUMNAR_SAMPLES'
+  COLUMNAR_FILE_SUFFIX = '.xcol'
+  TXN_FILE_SUFFIX = '.xtxn'
+  MULTIPLEXED_FILE_SIGNATURE = 0xC01DC01DC0FFEEED
+
   MIN_FIELD_COUNT = 2
   INDEX_TSC = 0
   INDEX_ADDR = 1
   INDEX_DATA = 2
   INDEX_PMC = 3
+  PMC_GROUP_PREFIX = 'g'
+
+  def parseProbeOverhead(self, record):
+    """
+    Parses overhead of probes, from a record in csv format
+
+    :param record: An overhead record - Overhead,<cycles>,<pmc values>...[,g<pmc group>]
+
+    """
+    fields = record.strip().split(',')[1:]
+    pmcGroup = 0
+    if fields and fields[-1].startswith(self.PMC_GROUP_PREFIX):
+      pmcGroup = int(fields.pop()[len(self.PMC_GROUP_PREFIX):])
+    return ProbeOverhead(int(fields[0]), [int(pmc) for pmc in fields[1:]], pmcGroup)
+
+  @staticmethod
+  def parseTscHz(record):
+    """
+    Parses frequency of time stamp counters, from a record in csv format
+
+    :param record: A tsc calibration record - TscCalibration,<tsc hz>,<source>,<socket>,<offset>
+
+    """
+    return int(record.strip().split(',')[1])
 
   def loadCounter(self, threadId, loader, probes, record):
     """
@@ -126,7 +388,10 @@ class Extractor(object):
 
     counter = Counter(threadId, probes[addr], data, tsc)
     if len(fields) > self.MIN_FIELD_COUNT:
-      for pmc in fields[self.MIN_FIELD_COUNT+1:]:
+      pmcFields = fields[self.MIN_FIELD_COUNT+1:]
+      if pmcFields and pmcFields[-1].startswith(self.PMC_GROUP_PREFIX):
+        counter.pmcGroup = int(pmcFields.pop()[len(self.PMC_GROUP_PREFIX):])
+      for pmc in pmcFields:
         counter.addPmc(int(pmc))
     if self.counterFilter.canLoad(counter):
       loader.loadCounter(counter)
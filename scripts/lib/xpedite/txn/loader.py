@@ -38,6 +38,7 @@ class AbstractTxnLoader(object):
     self.currentTxn = None
     self.threadId = None
     self.tlsAddr = None
+    self.probeOverhead = None
 
   def reset(self):
     """Resets the state of the loader"""
@@ -45,6 +46,7 @@ class AbstractTxnLoader(object):
     self.txns = OrderedDict()
     self.compromisedTxns = []
     self.nonTxnCounters = []
+    self.nonTxnCounterCount = 0
     self.ephemeralCounters = []
     self.currentTxn = None
 
@@ -58,7 +60,7 @@ class AbstractTxnLoader(object):
 
   def isNotAccounted(self):
     """Returns True, if any of the counters were skipped, due to data inconsistency"""
-    return len(self.nonTxnCounters) > 0
+    return len(self.nonTxnCounters) + self.nonTxnCounterCount > 0
 
   def appendTxn(self, txn):
     """
@@ -77,8 +79,8 @@ class AbstractTxnLoader(object):
     txnCount = len(self.txns) + len(self.compromisedTxns)
     report = 'processed {:,} counters to build {:,} trasactions ({:,} intact / {:,} compromised)'.format(
       self.processedCounterCount, txnCount, len(self.txns), len(self.compromisedTxns))
-    if self.nonTxnCounters:
-      report += ' and {:,} were accounted extraneous'.format(len(self.nonTxnCounters))
+    if self.isNotAccounted():
+      report += ' and {:,} were accounted extraneous'.format(len(self.nonTxnCounters) + self.nonTxnCounterCount)
     else:
       report += '.'
     return report
@@ -97,6 +99,32 @@ class AbstractTxnLoader(object):
   def endCollection(self):
     """Ends loading of samples from multiple threads of a target process"""
 
+  def loadProbeOverhead(self, probeOverhead):
+    """
+    Sets overhead of probes, for compensation of intervals between probes
+
+    Samples files of a profile, share the overhead calibrated at the start of the profile
+
+    :param probeOverhead: Overhead of probes, calibrated by the framework
+    :type probeOverhead: xpedite.types.ProbeOverhead
+
+    """
+    self.probeOverhead = probeOverhead
+
+  def loadTscCalibration(self, tscHz):
+    """
+    Replaces the frequency of cpu info, with the frequency calibrated by the samples loader
+
+    Estimated frequencies are refined by the samples loader, over the span of the profile
+
+    :param tscHz: Frequency of time stamp counters, in the samples file being loaded
+    :type tscHz: int
+
+    """
+    if tscHz and self.cpuInfo and tscHz != self.cpuInfo.frequency:
+      from xpedite.types import CpuInfo
+      self.cpuInfo = CpuInfo(self.cpuInfo.cpuId, tscHz)
+
   def beginLoad(self, threadId, tlsAddr):
     """Marks beginning of the current load session"""
     self.threadId = threadId
@@ -111,7 +139,8 @@ class AbstractTxnLoader(object):
   def getData(self):
     """Returns a collection of all the loaded transactions"""
     return TxnCollection(
-      self.name, self.cpuInfo, self.txns, self.probes, self.topdownMetrics, self.events, self.dataSource
+      self.name, self.cpuInfo, self.txns, self.probes, self.topdownMetrics, self.events, self.dataSource,
+      self.probeOverhead
     )
 
   def getCount(self):
@@ -209,6 +238,7 @@ class BoundedTxnLoader(AbstractTxnLoader):
     """
     AbstractTxnLoader.__init__(self, name, cpuInfo, probes, topdownMetrics, events)
     self.nextTxnId = 0
+    self.txnIdBase = 0
     self.ephemeralCounters = []
     self.nextFragmentId = 0
     self.fragments = TxnFragments()
@@ -277,6 +307,47 @@ class BoundedTxnLoader(AbstractTxnLoader):
       else:
         self.ephemeralCounters.append(counter)
 
+  def loadTxn(self, counters, txnId, elapsedTsc, pmcDeltas, probeDeltas):
+    """
+    Loads a transaction, built natively from counters of a thread
+
+    :param counters: Counters of the transaction, in the order of capture
+    :param txnId: Id of the transaction, assigned by the samples loader (zero for compromised transactions)
+    :param elapsedTsc: Tsc elapsed between the first and last counter of the transaction
+    :param pmcDeltas: Deltas of pmc values (last - first), None if counters span pmu event groups
+    :param probeDeltas: Tsc elapsed since the previous counter, for each counter of the transaction
+
+    """
+    self.processedCounterCount += len(counters)
+    txn = Transaction(counters[0], None)
+    for counter in counters[1:]:
+      txn.addCounter(counter, False)
+    txn.hasEndProbe = txnId != 0
+    txn.elapsedTsc = elapsedTsc
+    txn.pmcDeltas = pmcDeltas
+    txn.probeDeltas = probeDeltas
+    if txnId:
+      # ids are numbered per samples file, hence offset by the count of txns loaded from other files
+      txn.txnId = self.txnIdBase + txnId
+      self.nextTxnId = max(self.nextTxnId, txn.txnId)
+      AbstractTxnLoader.appendTxn(self, txn)
+    else:
+      self.compromisedTxns.append(txn)
+
+  def beginNativeTxns(self):
+    """Begins loading of transactions, built natively from a samples file"""
+    self.txnIdBase = self.nextTxnId
+
+  def skipNonTxnCounters(self, count):
+    """
+    Accounts counters of a thread, excluded from transactions built natively
+
+    :param count: Count of counters outside the bounds of any transaction
+
+    """
+    self.processedCounterCount += count
+    self.nonTxnCounterCount += count
+
   def buildTxn(self, counter, resumeTxn=False):
     """
     Constructs a new transaction instance
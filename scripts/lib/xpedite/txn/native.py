@@ -0,0 +1,100 @@
+"""
+Loader for transactions built natively
+
+The samples loader (xpediteSamplesLoader --txns) groups samples of a columnar file
+into transactions, bounded by begin/end probes and writes, for each transaction,
+the id, range of rows, elapsed tsc and pmc deltas, along with the tsc elapsed between
+consecutive probes, as arrays of a binary file.
+
+The loader builds transactions out of the row ranges, in place of grouping counters in python.
+Counters are built only for rows of transactions. Elapsed time, and deltas of transactions,
+with routes not needing conflation, are taken from the file, in place of recomputing them.
+
+Refer to bin/TxnBuilder.H for the layout of txn files.
+
+Author: Manikandan Dhamodharan, Morgan Stanley
+"""
+
+import struct
+
+class NativeTxns(object):
+  """Columns of transactions, loaded from a txn file"""
+
+  SIGNATURE = 0xC01DC01DC0FFEE7C
+  VERSION = 0x0102
+  HEADER_FORMAT = '<QIIQQII'
+  FLAG_FRAGMENTED = 1
+  STATUS_INTACT = 1
+  STATUS_COMPROMISED = 2
+  STATUS_PMC_DELTAS = 4
+
+  def __init__(self, path):
+    """
+    Maps columns of the given txn file
+
+    :param path: Path of the txn file
+
+    """
+    import numpy
+    headerSize = struct.calcsize(self.HEADER_FORMAT)
+    with open(path, 'rb') as fileHandle:
+      header = struct.unpack(self.HEADER_FORMAT, fileHandle.read(headerSize))
+    (signature, version, self.flags, self.txnCount, self.rowCount, self.pmcCount, _) = header
+    if signature != self.SIGNATURE or version != self.VERSION:
+      raise Exception('detected invalid txn file {} - signature {:x} | version {:x}'.format(path, signature, version))
+
+    txns = self.txnCount
+    buf = numpy.memmap(path, dtype=numpy.uint8, mode='r')
+    offset = [headerSize]
+    def column(dtype, count=txns):
+      """Maps the next column in the file"""
+      array = numpy.frombuffer(buf, dtype=dtype, count=count, offset=offset[0])
+      offset[0] += array.nbytes
+      return array
+
+    self.txnId = column('<u8')
+    self.rowBegin = column('<u8')
+    self.rowEnd = column('<u8')
+    self.elapsedTsc = column('<u8')
+    self.pmcDelta = column('<i8', txns * self.pmcCount).reshape(self.pmcCount, txns)
+    self.thread = column('<u4')
+    self.status = column('u1')
+    self.probeDelta = column('<u8', self.rowCount)
+
+  @property
+  def isFragmented(self):
+    """Returns True, if any of the transactions were suspended or resumed across threads"""
+    return bool(self.flags & self.FLAG_FRAGMENTED)
+
+  def threadTxns(self, threadIndex):
+    """
+    Yields id, row begin, row end, elapsed tsc and pmc deltas of transactions of a thread
+
+    Ids are zero for compromised transactions and pmc deltas are None, unless all counters of
+    the transaction were collected with the same pmu event group
+
+    :param threadIndex: Index of the thread in the thread table of the columnar file
+
+    """
+    import numpy
+    indices = numpy.nonzero(self.thread == threadIndex)[0]
+    txnIds = self.txnId[indices].tolist()
+    rowBegins = self.rowBegin[indices].tolist()
+    rowEnds = self.rowEnd[indices].tolist()
+    elapsedTscs = self.elapsedTsc[indices].tolist()
+    pmcDeltas = self.pmcDelta[:, indices].T.tolist()
+    status = self.status[indices].tolist()
+    for i, txnId in enumerate(txnIds):
+      yield (
+        txnId, rowBegins[i], rowEnds[i], elapsedTscs[i],
+        pmcDeltas[i] if status[i] & self.STATUS_PMC_DELTAS else None
+      )
+
+  def probeDeltas(self, rows):
+    """
+    Returns tsc elapsed since the previous probe of the transaction, for the given rows
+
+    :param rows: Indices of rows in the columnar file
+
+    """
+    return self.probeDelta[rows].tolist()
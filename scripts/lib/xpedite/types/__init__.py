@@ -16,6 +16,9 @@ class Counter(object):
 
   A counter can store cpu time stamp counter (tsc) and a collection
   of pmc values collected by any of the core and offcore pmu units
+
+  Counters of multiplexed pmu event groups, carry the id of the group (pmcGroup)
+  active at the time of collection, to let analytics scale counts by group
   """
 
   def __init__(self, threadId, probe, data, tsc):
@@ -26,6 +29,7 @@ class Counter(object):
     self.data = data
     self.tsc = tsc
     self.pmcs = []
+    self.pmcGroup = 0
 
   def addPmc(self, pmc):
     """
@@ -56,6 +60,38 @@ class Counter(object):
   def __eq__(self, other):
     return self.__dict__ == other.__dict__
 
+class ProbeOverhead(object):
+  """
+  Cost of recording a sample, calibrated by the framework at the start of a profile
+
+  Each interval between a pair of probes is inflated by the overhead of a probe -
+  cpu cycles and pmc values of the calibration, are subtracted from intervals in reports
+  Pmc values are compensated, only for counters collected with the calibrated pmu event group
+  """
+
+  def __init__(self, cycles, pmcs=None, pmcGroup=0):
+    self.cycles = cycles
+    self.pmcs = pmcs if pmcs else []
+    self.pmcGroup = pmcGroup
+
+  def compensatePmcs(self, pmcGroup, pmcCount):
+    """
+    Returns values to be subtracted from deltas of pmc, collected with the given event group
+
+    :param pmcGroup: Id of the pmu event group, active at the time of collection
+    :param pmcCount: Count of pmc values in the delta
+
+    """
+    if pmcGroup == self.pmcGroup and len(self.pmcs) == pmcCount:
+      return self.pmcs
+    return [0] * pmcCount
+
+  def __repr__(self):
+    return 'Probe overhead - {} cycles | pmc {} | pmc group {}'.format(self.cycles, self.pmcs, self.pmcGroup)
+
+  def __eq__(self, other):
+    return self.__dict__ == other.__dict__
+
 class DataSource(object):
   """Source of profile data"""
 
@@ -0,0 +1,79 @@
+#!/usr/bin/env python
+"""
+Gates xpedite micro benchmark results against a baseline
+
+Compares the overhead counters (cycles_per_hit, cycles_per_buffer, cycles_per_poll) of each
+benchmark in a baseline, with results of the current build, both in google benchmark json
+format. Benchmarks without overhead counters are compared by real time.
+
+usage: gate.py <baseline.json> <current.json> [--tolerance <percent>]
+
+Exits with a non zero status, if any benchmark regressed beyond the tolerance.
+Benchmarks skipped in either run (like pmc benchmarks, without the kernel module) are ignored.
+
+Author: Manikandan Dhamodharan, Morgan Stanley
+"""
+
+from __future__ import print_function
+import argparse
+import json
+import sys
+
+OVERHEAD_COUNTERS = ['cycles_per_hit', 'cycles_per_buffer', 'cycles_per_poll']
+
+def loadResults(path):
+  """
+  Loads overhead of benchmarks from a json file
+
+  :param path: Path to results of google benchmark, in json format
+
+  """
+  with open(path) as fileHandle:
+    report = json.load(fileHandle)
+  results = {}
+  for benchmark in report.get('benchmarks', []):
+    if benchmark.get('error_occurred') or benchmark.get('run_type', 'iteration') != 'iteration':
+      continue
+    metric = next((counter for counter in OVERHEAD_COUNTERS if counter in benchmark), 'real_time')
+    results[benchmark['name']] = (metric, float(benchmark[metric]))
+  return results
+
+def gate(baseline, current, tolerance):
+  """
+  Reports benchmarks, with overhead exceeding the baseline by more than the tolerance
+
+  :param baseline: Overhead of benchmarks in the baseline
+  :param current: Overhead of benchmarks in the current run
+  :param tolerance: Permitted increase in overhead, in percent
+
+  """
+  regressions = 0
+  for name in sorted(baseline):
+    if name not in current:
+      continue
+    metric, expected = baseline[name]
+    _, actual = current[name]
+    change = (actual - expected) * 100.0 / expected if expected else 0.0
+    isRegressed = change > tolerance
+    regressions += isRegressed
+    print('{:<72} {:<18} {:>14.2f} -> {:>14.2f} ({:+.1f}%){}'.format(
+      name, metric, expected, actual, change, ' REGRESSED' if isRegressed else ''
+    ))
+  return regressions
+
+def main():
+  """Gates results of the current run against a baseline"""
+  parser = argparse.ArgumentParser(description='gates xpedite benchmark results against a baseline')
+  parser.add_argument('baseline', help='results of baseline run (json)')
+  parser.add_argument('current', help='results of current run (json)')
+  parser.add_argument('--tolerance', type=float, default=10.0, help='permitted increase of overhead in percent')
+  args = parser.parse_args()
+
+  regressions = gate(loadResults(args.baseline), loadResults(args.current), args.tolerance)
+  if regressions:
+    print('detected overhead regression in {} benchmark(s)'.format(regressions), file=sys.stderr)
+    return 1
+  return 0
+
+if __name__ == '__main__':
+  sys.exit(main())
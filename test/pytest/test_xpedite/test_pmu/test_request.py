@@ -40,3 +40,41 @@ def test_request_sorter():
   LOGGER.info(eventState.genericRequests)
   for i, event in enumerate(events):
     assert event.uarchName == eventState.genericRequests[len(events)-i-1].uarchName
+
+def test_batch_request():
+  """
+  Test serialization of batch requests and parsing of per cpu status
+  """
+  import struct
+  from xpedite.pmu.pmuctrl import CPU_MAX, CPU_SKIPPED
+  eventsFile = os.path.join(os.path.dirname(__file__), 'test_events.json')
+  eventsDb = EventsLoader().loadJson(eventsFile)
+  cpuSet = [0, 3, 64, 255]
+  eventSet = PMUCtrl.buildEventSet(eventsDb, cpuSet, [Event('EVENT_0', 'EVENT_0'), Event('EVENT_1', 'EVENT_1')])
+  request = PMUCtrl.buildBatchRequest(cpuSet, eventSet)
+  requestGroup = PMUCtrl.buildRequestGroup(0, eventSet)
+  assert len(request) == CPU_MAX // 8 + len(requestGroup)
+  assert struct.unpack('=4Q', request[:CPU_MAX // 8]) == ((1 << 0) | (1 << 3), 1, 0, 1 << 63)
+  assert request[CPU_MAX // 8:] == requestGroup
+
+  codes = [CPU_SKIPPED] * CPU_MAX
+  codes[0], codes[3], codes[64], codes[255] = 0, -14, 0, -6
+  status = struct.pack('={}i'.format(CPU_MAX), *codes)
+  assert PMUCtrl.parseBatchStatus(cpuSet, status) == {3 : -14, 255 : -6}
+
+def test_single_cpu_requests():
+  """
+  Test partitioning of cpus beyond the capacity of batch requests, to requests per cpu
+  """
+  import struct
+  from xpedite.pmu.pmuctrl import CPU_MAX
+  eventsFile = os.path.join(os.path.dirname(__file__), 'test_events.json')
+  eventsDb = EventsLoader().loadJson(eventsFile)
+  cpuSet = [CPU_MAX + 3, 1, CPU_MAX - 1, CPU_MAX]
+  assert PMUCtrl.partitionCpus(cpuSet) == ([1, CPU_MAX - 1], [CPU_MAX, CPU_MAX + 3])
+  assert PMUCtrl.partitionCpus([0, 2]) == ([0, 2], [])
+
+  eventSet = PMUCtrl.buildEventSet(eventsDb, cpuSet, [Event('EVENT_0', 'EVENT_0')])
+  request = PMUCtrl.buildRequestGroup(CPU_MAX + 3, eventSet)
+  assert struct.unpack('=HBBB', request[:5]) == (CPU_MAX + 3, 0, 1, 0)
+  assert request[2:] == PMUCtrl.buildRequestGroup(0, eventSet)[2:]
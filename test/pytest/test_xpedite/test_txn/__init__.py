@@ -0,0 +1,5 @@
+"""
+This package contains pytests for Xpedite's transaction loaders, including:
+
+- Tests for loading of transactions, built natively by the samples loader
+"""
@@ -0,0 +1,95 @@
+"""
+
+Test to load transactions, built natively by the samples loader
+
+The txn file is built with the layout of bin/TxnBuilder.H, for transactions matching
+the samples of test/gtest/TxnBuilder.C
+
+Author: Manikandan Dhamodharan, Morgan Stanley
+
+"""
+
+import struct
+from xpedite.txn.native     import NativeTxns
+from xpedite.txn.loader     import BoundedTxnLoader
+from xpedite.types          import Counter
+
+STATUS_INTACT = NativeTxns.STATUS_INTACT
+STATUS_COMPROMISED = NativeTxns.STATUS_COMPROMISED
+STATUS_PMC_DELTAS = NativeTxns.STATUS_PMC_DELTAS
+
+TXN_IDS = [1, 2, 0]
+ROW_BEGINS = [1, 5, 8]
+ROW_ENDS = [5, 7, 10]
+ELAPSED_TSCS = [100, 50, 100]
+PMC_DELTAS = [[20, 0, 0], [80, 0, 0]]
+THREADS = [0, 0, 0]
+STATUS = [STATUS_INTACT | STATUS_PMC_DELTAS, STATUS_INTACT, STATUS_COMPROMISED]
+PROBE_DELTAS = [0, 0, 50, 0, 50, 0, 50, 0, 0, 100]
+
+def buildTxnFile(path):
+  """Writes a txn file, with a thread of intact and compromised transactions"""
+  txnCount = len(TXN_IDS)
+  with open(path, 'wb') as fileHandle:
+    fileHandle.write(struct.pack(
+      NativeTxns.HEADER_FORMAT, NativeTxns.SIGNATURE, NativeTxns.VERSION, 0, txnCount,
+      len(PROBE_DELTAS), len(PMC_DELTAS), 0
+    ))
+    for values in (TXN_IDS, ROW_BEGINS, ROW_ENDS, ELAPSED_TSCS):
+      fileHandle.write(struct.pack('<{}Q'.format(txnCount), *values))
+    for values in PMC_DELTAS:
+      fileHandle.write(struct.pack('<{}q'.format(txnCount), *values))
+    fileHandle.write(struct.pack('<{}I'.format(txnCount), *THREADS))
+    fileHandle.write(struct.pack('<{}B'.format(txnCount), *STATUS))
+    fileHandle.write(struct.pack('<{}Q'.format(len(PROBE_DELTAS)), *PROBE_DELTAS))
+
+def test_native_txns_reader(tmpdir):
+  """
+  Test mapping of columns and iteration of transactions in a txn file
+  """
+  path = str(tmpdir.join('test.xtxn'))
+  buildTxnFile(path)
+  nativeTxns = NativeTxns(path)
+  assert not nativeTxns.isFragmented
+  assert nativeTxns.txnCount == 3
+  assert nativeTxns.rowCount == len(PROBE_DELTAS)
+  assert nativeTxns.pmcCount == 2
+
+  txns = list(nativeTxns.threadTxns(0))
+  assert txns == [
+    (1, 1, 5, 100, [20, 80]),
+    (2, 5, 7, 50, None),
+    (0, 8, 10, 100, None),
+  ]
+  assert not list(nativeTxns.threadTxns(1))
+  assert nativeTxns.probeDeltas(list(range(1, 5))) == [0, 50, 0, 50]
+  assert nativeTxns.probeDeltas([8, 9]) == [0, 100]
+
+def test_native_txns_loader():
+  """
+  Test loading of natively built transactions, with ids offset across samples files
+  """
+  loader = BoundedTxnLoader('test', None, [], [], None)
+  def buildCounters(tscs):
+    """Builds counters for tsc values of a transaction"""
+    return [Counter(7, None, '', tsc) for tsc in tscs]
+
+  for _ in range(2):
+    loader.beginNativeTxns()
+    loader.loadTxn(buildCounters([200, 250, 300]), 1, 100, [20, 80], [0, 50, 50])
+    loader.loadTxn(buildCounters([400, 450]), 2, 50, None, [0, 50])
+    loader.loadTxn(buildCounters([600, 700]), 0, 100, None, [0, 100])
+    loader.skipNonTxnCounters(2)
+
+  assert list(loader.txns.keys()) == [1, 2, 3, 4]
+  assert len(loader.compromisedTxns) == 2
+  assert loader.processedCounterCount == 2 * (7 + 2)
+  assert loader.isNotAccounted()
+
+  txn = loader.txns[3]
+  assert txn.hasEndProbe
+  assert txn.getElapsedTsc() == 100
+  assert txn.pmcDeltas == [20, 80]
+  assert txn.probeDeltas == [0, 50, 50]
+  assert len(txn.counters) == 3
+  assert not loader.compromisedTxns[0].hasEndProbe
@@ -165,6 +165,15 @@ function runGtests() {
     echo detected failure of one or more gtests
     RC=$(($RC + 1))
   fi
+
+  # vivify gtests are built only with support for call stacks (build.sh --withCallStacks)
+  VIVIFY_TEST_APP=${TEST_DIR}/../install/test/testVivify
+  if [ -x ${VIVIFY_TEST_APP} ]; then
+    if ! ${VIVIFY_TEST_APP}; then
+      echo detected failure of one or more vivify gtests
+      RC=$(($RC + 1))
+    fi
+  fi
 }
 
 function runAllTests() {